@@ -1483,6 +1483,9 @@
 #define EEPROM_BOOT_SILENT    // Keep M503 quiet and only give errors during first load
 #if ENABLED(EEPROM_SETTINGS)
   #define EEPROM_AUTO_INIT  // Init EEPROM automatically on any errors.
+  //#define EEPROM_STAGED_WRITE // Stage settings in a RAM image and only write the blocks that changed.
+                                // The image is a full copy of the stored settings, kept in SRAM. (Typically 500-1000 bytes. Limited to 1/8 of SRAM on AVR.)
+  //#define EEPROM_TAGGED_SETTINGS // Tag each group of settings so a new EEPROM_VERSION keeps the groups it still knows. (Requires EEPROM_STAGED_WRITE)
 #endif
 
 //
@@ -52,6 +52,13 @@
  */
 #define THERMOCOUPLE_MAX_ERRORS 15
 
+/**
+ * Convert thermistor readings with an index of the conversion table built
+ * at compile time, instead of a bisect search and a float divide per reading.
+ * Costs about 64 bytes plus 4 bytes per table entry of flash for each sensor.
+ */
+//#define THERMISTOR_INDEXED_LOOKUP
+
 //
 // Custom Thermistor 1000 parameters
 //
@@ -115,6 +122,10 @@
   #define CHAMBER_BETA                 3950    // Beta value
 #endif
 
+// Convert custom thermistor readings with a table built when the parameters
+// change, instead of evaluating the formula for every reading. (12 bytes of SRAM per point, 10 on AVR)
+//#define USER_THERMISTOR_TABLE 64   // Points per custom thermistor
+
 //
 // Hephestos 2 24V heated bed upgrade kit.
 // https://store.bq.com/en/heated-bed-kit-hephestos2
@@ -1178,6 +1189,11 @@
     // Without a POWER_LOSS_PIN the following option helps reduce wear on the SD card,
     // especially with "vase mode" printing. Set too high and vases cannot be continued.
     #define POWER_LOSS_MIN_Z_CHANGE 0.05 // (mm) Minimum Z change before saving power-loss data
+
+    // Keep the recovery data in a preallocated, contiguous file, one sector per save.
+    // Saves are raw sector writes with no FAT or directory updates, and recovery takes
+    // the newest record with a good CRC. Makes SAVE_EACH_CMD_MODE practical. Uses 512 bytes of RAM.
+    //#define POWER_LOSS_JOURNAL 16       // (sectors) Records kept in the journal
   #endif
 
   /**
@@ -1296,6 +1312,21 @@
 
   // Add an optimized binary file transfer mode, initiated with 'M28 B1'
   //#define BINARY_FILE_TRANSFER
+  #if ENABLED(BINARY_FILE_TRANSFER)
+    // Acknowledge packets as soon as they arrive, into this many buffers, so the host
+    // can send that many ahead while earlier ones are unpacked and written. Without a
+    // USB port the serial receive buffer must hold that many packets as well.
+    //#define BINARY_STREAM_BUFFERS 2
+    #define BINARY_STREAM_PACKET_SIZE 512 // (bytes) Largest packet with BINARY_STREAM_BUFFERS
+  #endif
+
+  // Read this many blocks ahead of the file being printed, in idle time and with
+  // multiple-block transfers, so commands don't wait on the card. (512 bytes each)
+  //#define SD_READ_AHEAD 4
+
+  // Keep this many runs of contiguous clusters of the file being printed, so
+  // reading on and seeking (M26, power-loss resume) don't follow the FAT.
+  //#define SD_EXTENT_CACHE 8
 
   /**
    * Set this option to one of the following (or the board's defaults apply):
@@ -1350,6 +1381,18 @@
   // Swap the CW/CCW indicators in the graphics overlay
   //#define OVERLAY_GFX_REVERSE
 
+  /**
+   * Send only the display pages that changed since the last screen update.
+   * The status screen mostly changes in a few places, so most pages are skipped,
+   * saving the SPI / I2C transfer time. Only for U8GLIB_ST7920 (except
+   * REPRAPWORLD_GRAPHICAL_LCD), U8GLIB_ST7565_64128N, the UC1701 Mini 12864
+   * displays and the upscaled 128x64 on TFT. Costs 4 bytes of RAM per 8 rows.
+   */
+  //#define DOGM_SKIP_UNCHANGED_PAGES
+  #if ENABLED(DOGM_SKIP_UNCHANGED_PAGES)
+    #define DOGM_FULL_REFRESH_INTERVAL 10 // (s) Send all pages at this interval to repair a garbled display
+  #endif
+
   /**
    * ST7920-based LCDs can emulate a 16 x 4 character display using
    * the ST7920 character-generator for very fast screen updates.
@@ -1437,6 +1480,16 @@
   #endif
 #endif // HAS_DGUS_LCD
 
+//
+// Additional options for the CR-6 DWIN touch screen
+//
+#if ENABLED(DWIN_CREALITY_TOUCHLCD)
+  //#define DWIN_TOUCHLCD_VP_QUEUE 64     // Queue variable writes, sending only changed values in multi-word frames
+  #ifdef DWIN_TOUCHLCD_VP_QUEUE
+    #define DWIN_TOUCHLCD_TX_BUFFER_SIZE 256  // (bytes) Frames waiting to go to the USART
+  #endif
+#endif
+
 //
 // Touch UI for the FTDI Embedded Video Engine (EVE)
 //
@@ -1540,6 +1593,19 @@
   //#define TFT_BTOKMENU_COLOR 0x145F // 00010 100010 11111 Cyan
 #endif
 
+#if HAS_GRAPHICAL_TFT
+  /**
+   * Skip drawing a fill or canvas when the same task last drew that area and
+   * nothing has been drawn over it since. Status screen values that didn't
+   * change aren't rendered or sent again. M598 reports the frame times and the
+   * pixels drawn and skipped.
+   */
+  //#define TFT_SKIP_UNCHANGED_AREAS
+  #if ENABLED(TFT_SKIP_UNCHANGED_AREAS)
+    #define TFT_AREA_CACHE_SIZE 48    // Areas remembered, 12 bytes of RAM each
+  #endif
+#endif
+
 //
 // ADC Button Debounce
 //
@@ -1766,6 +1832,8 @@
   //#define ARC_SEGMENTS_PER_R    1 // Max segment length, MM_PER = Min
   #define MIN_ARC_SEGMENTS       24 // Minimum number of segments in a complete circle
   //#define ARC_SEGMENTS_PER_SEC 50 // Use feedrate to choose segment length (with MM_PER_ARC_SEGMENT as the minimum)
+  //#define ARC_CHORD_TOLERANCE  10 // (µm) Use the fewest segments that stay within this chord error. Set with M596 S<µm>.
+  //#define NATIVE_ARCS             // Step XY arcs along the true circle, with one block per octant instead of many segments (32-bit only)
   #define N_ARC_CORRECTION       25 // Number of interpolated segments between corrections
   //#define ARC_P_CIRCLES           // Enable the 'P' parameter to specify complete circles
   //#define CNC_WORKSPACE_PLANES    // Allow G2/G3 to operate in XY, ZX, or YZ planes
@@ -1773,6 +1841,9 @@
 
 // Support for G5 with XYZE destination and IJPQ offsets. Requires ~2666 bytes.
 //#define BEZIER_CURVE_SUPPORT
+#if ENABLED(BEZIER_CURVE_SUPPORT)
+  #define BEZIER_TOLERANCE 0.02 // (mm) Maximum distance between the curve and the lines that trace it
+#endif
 
 /**
  * Direct Stepping
@@ -1864,6 +1935,50 @@
   #define BLOCK_BUFFER_SIZE 16
 #endif
 
+/**
+ * Incremental planner recalculation
+ *
+ * Normally every new block re-plans the whole buffer back to the last
+ * optimally planned block. With this option the reverse pass stops at the
+ * first junction whose entry speed doesn't change, and the forward pass and
+ * trapezoid updates start from there. This keeps the planner cost per block
+ * low with a large BLOCK_BUFFER_SIZE and dense arc or curve segments.
+ */
+//#define INCREMENTAL_PLANNER
+
+/**
+ * Fixed-point planner
+ *
+ * Plan junction speeds with integer (Q24.8) speeds squared and compute block
+ * trapezoids from integer step rates. This avoids soft-float math in the
+ * planner kernels on MCUs without an FPU, such as AVR and STM32F1.
+ * Speeds are limited to 4096mm/s.
+ */
+//#define PLANNER_FIXED_POINT
+
+/**
+ * Stepper block preparation
+ *
+ * Work out the block start state (step smoothing, Bézier coefficients and
+ * the initial timer interval) for the next blocks from the main loop, so the
+ * stepper ISR only copies a prepared record when a new block starts.
+ * Use M594 to report and reset the longest block start in the stepper ISR.
+ */
+//#define STEPPER_BLOCK_PREP
+#if ENABLED(STEPPER_BLOCK_PREP)
+  #define STEPPER_BLOCK_PREP_AHEAD 4  // Blocks to prepare ahead. A power of 2, up to BLOCK_BUFFER_SIZE.
+#endif
+
+/**
+ * Packed Bresenham
+ *
+ * Advance the Bresenham error of all axes at once in the stepper pulse phase,
+ * two axes per 64-bit word, and step from the resulting mask without branches.
+ * Run the LINUX HAL motion benchmark with '--bresenham' to compare both forms.
+ * 32-bit boards only. The 64-bit adds are far slower than the scalar loop on AVR.
+ */
+//#define BRESENHAM_SWAR
+
 // @section serial
 
 // The ASCII buffer for serial input
@@ -3150,6 +3265,9 @@
 
 #if ENABLED(FASTER_GCODE_PARSER)
   //#define GCODE_QUOTED_STRINGS  // Support for quoted string parameters
+  //#define PACKED_GCODE          // Accept pre-parsed binary commands from buildroot/share/scripts/pack_gcode.py
+                                  // Over serial each one counts as the next line number (N), and a bad one gets a resend request.
+  //#define GCODE_PREPARSE        // Parse commands as they are queued so execution only dispatches. (~80 bytes SRAM per BUFSIZE)
 #endif
 
 //#define GCODE_CASE_INSENSITIVE  // Accept G-code sent to the firmware in lowercase
@@ -3532,3 +3650,36 @@
 
 // Enable Marlin dev mode which adds some special commands
 //#define MARLIN_DEV_MODE
+
+/**
+ * Stepper ISR timing histograms
+ * Record how long each stepper ISR phase (pulse, block, advance, babystep)
+ * and each whole ISR call take, the delay from the scheduled time to ISR
+ * entry, and how many times the ISR loops. Times are in stepper timer ticks.
+ * Use M595 to report the histograms and 'M595 R' to reset them.
+ * The LINUX HAL also prints them on exit.
+ */
+//#define STEPPER_ISR_TIMING
+
+/**
+ * Idle task scheduler
+ * Give each task in idle() (UI, media, LEDs, heaters...) a period and a time
+ * budget. While the planner buffer is running short the UI, media and other
+ * low-priority tasks wait, so they can't starve the planner and cause stutter.
+ * Use M597 to report the run counts and times of each task, 'M597 R' to reset.
+ */
+//#define IDLE_TASK_SCHEDULER
+#if ENABLED(IDLE_TASK_SCHEDULER)
+  #define IDLE_TASK_MIN_BUFFER_MS   30  // (ms) Defer low-priority tasks while less motion than this is buffered
+  #define IDLE_TASK_MAX_DEFER_MS  1000  // (ms) Run a deferred task after this long anyway
+#endif
+
+/**
+ * Headless motion benchmark for the LINUX HAL (env:linux_native_benchmark)
+ * Pass a G-code file to the built program to replay it in virtual time and report
+ * planner blocks/s, stepper ISR calls and the host time spent per ISR phase, in
+ * stepper timer ticks. Reading the clock takes no virtual time.
+ * Add '--trace <file>' to record every step, and use '--compare <golden> <new>'
+ * to report the position divergence and timing drift between two such traces.
+ */
+//#define MOTION_BENCHMARK
@@ -79,6 +79,12 @@ extern HalSerial usb_serial;
 
 inline void HAL_init() {}
 
+#if ENABLED(MOTION_BENCHMARK)
+  #include "benchmark.h"
+  #define HAL_IDLETASK 1
+  void HAL_idletask();
+#endif
+
 // Utility functions
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-function"
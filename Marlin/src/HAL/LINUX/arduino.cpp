@@ -39,6 +39,10 @@ uint32_t millis() {
   return (uint32_t)Clock::millis();
 }
 
+uint32_t micros() {
+  return (uint32_t)Clock::micros();
+}
+
 // This is required for some Arduino libraries we are using
 void delayMicroseconds(uint32_t us) {
   Clock::delayMicros(us);
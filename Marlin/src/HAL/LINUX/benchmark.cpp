@@ -0,0 +1,138 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(MOTION_BENCHMARK)
+
+#include "hardware/Timer.h"
+#include "../../gcode/queue.h"
+#include "../../module/planner.h"
+#include "../../module/stepper.h"
+#if ENABLED(SDSUPPORT)
+  #include "../../sd/cardreader.h"
+#endif
+
+MotionBenchmark motion_bench;
+
+uint32_t MotionBenchmark::planner_blocks, MotionBenchmark::isr_calls;
+MotionBenchmark::phase_stats_t MotionBenchmark::pulse_phase, MotionBenchmark::block_phase;
+
+FILE *MotionBenchmark::input;
+const char *MotionBenchmark::input_path;
+Peripheral *MotionBenchmark::peripherals[8];
+uint8_t MotionBenchmark::peripheral_count;
+uint64_t MotionBenchmark::start_sim_ns, MotionBenchmark::start_host_ns;
+
+void HAL_idletask() { motion_bench.idle(); }
+
+bool MotionBenchmark::open(const char * const path) {
+  input_path = path;
+  input = fopen(path, "r");
+  return input != nullptr;
+}
+
+void MotionBenchmark::attach(Peripheral * const per) {
+  if (peripheral_count < COUNT(peripherals)) peripherals[peripheral_count++] = per;
+}
+
+void MotionBenchmark::start() {
+  planner_blocks = isr_calls = 0;
+  pulse_phase = block_phase = {};
+  planner.recalc_stats = {};
+  #if ENABLED(STEPPER_BLOCK_PREP)
+    stepper.blocks_started = stepper.blocks_prepared = 0;
+  #endif
+  start_sim_ns = Clock::nanos();
+  start_host_ns = host_nanos();
+}
+
+// Keep the serial receive buffer topped up from the G-code file
+void MotionBenchmark::feed() {
+  static int last_c = '\n';
+  while (input && !usb_serial.receive_buffer.full()) {
+    const int c = fgetc(input);
+    if (c == EOF) {
+      if (last_c != '\n') usb_serial.receive_buffer.write('\n'); // Terminate the last line
+      fclose(input);
+      input = nullptr;
+      break;
+    }
+    usb_serial.receive_buffer.write(last_c = c);
+  }
+}
+
+/**
+ * Called from idle(). The main loop takes no virtual time of its own,
+ * so skip ahead to the next timer event and let its ISR run. This and
+ * the delay functions are the only places where virtual time moves.
+ */
+void MotionBenchmark::idle() {
+  feed();
+
+  const uint64_t now = Clock::nanos(), next = Timer::nextDeadline();
+  Clock::advance(next == UINT64_MAX ? 1000000UL : next > now ? next - now : 0);
+
+  for (uint8_t i = 0; i < peripheral_count; i++) peripherals[i]->update();
+}
+
+bool MotionBenchmark::finished() {
+  return !input
+      && usb_serial.receive_buffer.empty()
+      && TERN1(SDSUPPORT, !card.isFileOpen())
+      && !queue.has_commands_queued()
+      && !planner.has_blocks_queued();
+}
+
+void MotionBenchmark::report() {
+  const double sim_s = (Clock::nanos() - start_sim_ns) / 1e9,
+               host_s = (host_nanos() - start_host_ns) / 1e9;
+
+  // Host time in stepper timer ticks, as the phase would take at STEPPER_TIMER_RATE
+  auto report_phase = [](const char * const name, const phase_stats_t &ps) {
+    constexpr double ticks_per_ns = (STEPPER_TIMER_RATE) / 1e9;
+    printf("  %-16s: %u calls, %.0f ticks total, %.2f ticks avg, %.2f ticks max\n", name, ps.calls,
+      ps.host_ns * ticks_per_ns, ps.calls ? ps.host_ns * ticks_per_ns / ps.calls : 0.0, ps.max_ns * ticks_per_ns);
+  };
+
+  printf("\nMotion benchmark: %s\n", input_path);
+  printf("  simulated time  : %.3f s\n", sim_s);
+  printf("  host time       : %.3f s (%.1fx real time)\n", host_s, host_s > 0 ? sim_s / host_s : 0.0);
+  printf("  planner blocks  : %u (%.1f blocks/s host, %.1f blocks/s simulated)\n", planner_blocks,
+    host_s > 0 ? planner_blocks / host_s : 0.0, sim_s > 0 ? planner_blocks / sim_s : 0.0);
+  const planner_recalc_stats_t &rs = planner.recalc_stats;
+  const double per_block = rs.recalculations ? 1.0 / rs.recalculations : 0.0;
+  printf("  planner recalc  : %u calls, per call %.2f reverse + %.2f forward + %.2f trapezoid kernels, %.2f trapezoids\n",
+    rs.recalculations, rs.reverse_kernels * per_block, rs.forward_kernels * per_block,
+    rs.trapezoid_kernels * per_block, rs.trapezoids * per_block);
+  printf("  stepper ISR     : %u calls\n", isr_calls);
+  report_phase("pulse_phase_isr", pulse_phase);
+  report_phase("block_phase_isr", block_phase);
+  #if ENABLED(STEPPER_BLOCK_PREP)
+    printf("  block prep      : %u of %u blocks started from a prepared record\n", stepper.blocks_prepared, stepper.blocks_started);
+  #endif
+  fflush(stdout);
+}
+
+#endif // MOTION_BENCHMARK
+#endif // __PLAT_LINUX__
@@ -0,0 +1,81 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Headless motion benchmark
+ *
+ * Replays a G-code file through the serial input in virtual time, so the
+ * queue, parser, planner and stepper ISR run as fast as the host allows and
+ * every run of the same file and configuration is identical.
+ */
+
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "hardware/Gpio.h"
+
+class MotionBenchmark {
+public:
+  typedef struct {
+    uint32_t calls;
+    uint64_t host_ns, max_ns;
+  } phase_stats_t;
+
+  static uint32_t planner_blocks,   // Blocks added to the planner
+                  isr_calls;        // Stepper ISR invocations
+  static phase_stats_t pulse_phase, block_phase;
+
+  static bool open(const char * const path);
+  static void attach(Peripheral * const per);
+  static void start();
+  static void idle();
+  static bool finished();
+  static void report();
+  static int eeprom();
+
+  static uint64_t host_nanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  static void account(phase_stats_t &ps, const uint64_t since) {
+    const uint64_t ns = host_nanos() - since;
+    ps.calls++;
+    ps.host_ns += ns;
+    if (ns > ps.max_ns) ps.max_ns = ns;
+  }
+
+private:
+  static void feed();
+
+  static FILE *input;
+  static const char *input_path;
+  static Peripheral *peripherals[8];
+  static uint8_t peripheral_count;
+  static uint64_t start_sim_ns, start_host_ns;
+};
+
+extern MotionBenchmark motion_bench;
+
+// Time a stepper ISR phase in host nanoseconds
+#define MOTION_BENCH_PHASE(P, F) do{ const uint64_t _bench_ns = MotionBenchmark::host_nanos(); F; MotionBenchmark::account(MotionBenchmark::P##_phase, _bench_ns); }while(0)
@@ -33,72 +33,137 @@
 #endif
 
 uint8_t buffer[MARLIN_EEPROM_SIZE];
-char filename[] = "eeprom.dat";
+const char *filename = "eeprom.dat";
+
+// Store traffic, for the benchmark
+static struct {
+  uint32_t bytes_read, bytes_written, bytes_changed, file_writes;
+} eeprom_stats;
+static bool eeprom_dirty;
 
 size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE; }
 
 bool PersistentStore::access_start() {
   const char eeprom_erase_value = 0xFF;
-  FILE * eeprom_file = fopen(filename, "rb");
-  if (eeprom_file == nullptr) return false;
-
-  fseek(eeprom_file, 0L, SEEK_END);
-  std::size_t file_size = ftell(eeprom_file);
+  eeprom_dirty = false;
 
-  if (file_size < MARLIN_EEPROM_SIZE) {
-    memset(buffer + file_size, eeprom_erase_value, MARLIN_EEPROM_SIZE - file_size);
-  }
-  else {
-    fseek(eeprom_file, 0L, SEEK_SET);
-    fread(buffer, sizeof(uint8_t), sizeof(buffer), eeprom_file);
+  // A missing or short file reads as erased
+  std::size_t file_size = 0;
+  FILE * eeprom_file = fopen(filename, "rb");
+  if (eeprom_file) {
+    file_size = fread(buffer, sizeof(uint8_t), sizeof(buffer), eeprom_file);
+    fclose(eeprom_file);
   }
+  if (file_size < MARLIN_EEPROM_SIZE)
+    memset(buffer + file_size, eeprom_erase_value, MARLIN_EEPROM_SIZE - file_size);
 
-  fclose(eeprom_file);
   return true;
 }
 
 bool PersistentStore::access_finish() {
+  if (!eeprom_dirty) return true;
   FILE * eeprom_file = fopen(filename, "wb");
   if (eeprom_file == nullptr) return false;
   fwrite(buffer, sizeof(uint8_t), sizeof(buffer), eeprom_file);
   fclose(eeprom_file);
+  eeprom_dirty = false;
+  eeprom_stats.file_writes++;
   return true;
 }
 
 bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
-  std::size_t bytes_written = 0;
+  if (pos < 0 || pos + size > MARLIN_EEPROM_SIZE) return true;
 
   for (std::size_t i = 0; i < size; i++) {
-    buffer[pos+i] = value[i];
-    bytes_written ++;
+    if (buffer[pos + i] == value[i]) continue;
+    buffer[pos + i] = value[i];
+    eeprom_stats.bytes_changed++;
+    eeprom_dirty = true;
   }
+  eeprom_stats.bytes_written += size;
 
   crc16(crc, value, size);
-  pos = pos + size;
-  return (bytes_written != size);  // return true for any error
+  pos += size;
+  return false;
 }
 
 bool PersistentStore::read_data(int &pos, uint8_t* value, const size_t size, uint16_t *crc, const bool writing/*=true*/) {
-  std::size_t bytes_read = 0;
-  if (writing) {
-    for (std::size_t i = 0; i < size; i++) {
-      value[i] = buffer[pos+i];
-      bytes_read ++;
-    }
-    crc16(crc, value, size);
-  }
-  else {
-    uint8_t temp[size];
-    for (std::size_t i = 0; i < size; i++) {
-      temp[i] = buffer[pos+i];
-      bytes_read ++;
-    }
-    crc16(crc, temp, size);
-  }
+  if (pos < 0 || pos + size > MARLIN_EEPROM_SIZE) return true;
+
+  if (writing) memcpy(value, &buffer[pos], size);
+  crc16(crc, &buffer[pos], size);
+  eeprom_stats.bytes_read += size;
 
-  pos = pos + size;
-  return bytes_read != size;  // return true for any error
+  pos += size;
+  return false;
 }
 
+#if ENABLED(MOTION_BENCHMARK)
+
+  #include "benchmark.h"
+  #include "selftest.h"
+  #include "../../module/settings.h"
+  #include "../../module/planner.h"
+
+  /**
+   * Time M500 and M501 against a scratch file and count the store traffic
+   * of each: bytes passed to the store, bytes it changed, and file writes.
+   * Then compare crc16() with the bitwise CRC it replaced and, with
+   * tagged settings, load stores saved with another E stepper count.
+   */
+  int MotionBenchmark::eeprom() {
+    constexpr uint16_t runs = 1000;
+    const char * const saved_filename = filename;
+    filename = "eeprom_bench.dat";
+    remove(filename);
+
+    auto run = [&](const char * const name, bool (*op)(), void (*change)()) {
+      eeprom_stats = {};
+      uint64_t ns = 0;
+      bool ok = true;
+      for (uint16_t i = 0; i < runs; i++) {
+        if (change) change();
+        const uint64_t t = host_nanos();
+        ok &= op();
+        ns += host_nanos() - t;
+      }
+      printf("%-18s %8.2f us %8u %8u %8u %6u%s\n", name, ns * 0.001 / runs,
+        eeprom_stats.bytes_read / runs, eeprom_stats.bytes_written / runs, eeprom_stats.bytes_changed / runs,
+        eeprom_stats.file_writes, ok ? "" : "  FAILED");
+    };
+
+    printf("\nEEPROM settings: %u bytes, %u runs%s\n", unsigned(settings.datasize()), runs, TERN(EEPROM_STAGED_WRITE, " (staged)", ""));
+    printf("%-18s %11s %8s %8s %8s %6s\n", "", "time", "read", "written", "changed", "files");
+    run("M500 first", []{ remove(filename); return settings.save(); }, nullptr);
+    run("M500 unchanged", []{ return settings.save(); }, nullptr);
+    run("M500 one change", []{ return settings.save(); }, []{ planner.settings.axis_steps_per_mm[X_AXIS] += 0.01f; });
+    run("M501", []{ return settings.load(); }, nullptr);
+
+    // The bitwise CRC-16/XMODEM that crc16() used to be
+    auto crc16_bitwise = [](uint16_t *crc, const uint8_t *ptr, uint16_t cnt) {
+      while (cnt--) {
+        *crc ^= uint16_t(*ptr++) << 8;
+        LOOP_L_N(i, 8) *crc = (*crc & 0x8000) ? uint16_t(*crc << 1) ^ 0x1021 : uint16_t(*crc << 1);
+      }
+    };
+    uint16_t crc_a = 0, crc_b = 0;
+    uint64_t t = host_nanos();
+    for (uint16_t i = 0; i < runs; i++) crc16_bitwise(&crc_a, buffer, sizeof(buffer));
+    const uint64_t bitwise_ns = host_nanos() - t;
+    t = host_nanos();
+    for (uint16_t i = 0; i < runs; i++) crc16(&crc_b, buffer, sizeof(buffer));
+    const uint64_t table_ns = host_nanos() - t;
+    printf("CRC16 bitwise %.1f MB/s, table %.1f MB/s%s\n",
+      1e3 * runs * sizeof(buffer) / bitwise_ns, 1e3 * runs * sizeof(buffer) / table_ns, crc_a == crc_b ? "" : "  MISMATCH");
+
+    const bool esteppers_ok = TERN1(EEPROM_TAGGED_SETTINGS, SelfTest::eeprom_esteppers());
+
+    remove(filename);
+    filename = saved_filename;
+    return crc_a == crc_b && esteppers_ok ? 0 : 2;
+  }
+
+#endif // MOTION_BENCHMARK
+
 #endif // EEPROM_SETTINGS
 #endif // __PLAT_LINUX__
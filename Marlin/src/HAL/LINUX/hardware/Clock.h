@@ -45,6 +45,7 @@ public:
 
   // Time Acceleration compensated
   static uint64_t nanos() {
+    if (Clock::virtual_time) return Clock::virtual_nanos;
     auto now = std::chrono::high_resolution_clock::now().time_since_epoch();
     return (now.count() - Clock::startup.count()) * Clock::time_multiplier;
   }
@@ -62,18 +63,22 @@ public:
   }
 
   static void delayCycles(uint64_t cycles) {
+    if (Clock::virtual_time) return Clock::advance((1000000000L / frequency) * cycles);
     std::this_thread::sleep_for(std::chrono::nanoseconds( (1000000000L / frequency) * cycles) / Clock::time_multiplier );
   }
 
   static void delayMicros(uint64_t micros) {
+    if (Clock::virtual_time) return Clock::advance(micros * 1000);
     std::this_thread::sleep_for(std::chrono::microseconds( micros ) / Clock::time_multiplier);
   }
 
   static void delayMillis(uint64_t millis) {
+    if (Clock::virtual_time) return Clock::advance(millis * 1000000);
     std::this_thread::sleep_for(std::chrono::milliseconds( millis ) / Clock::time_multiplier);
   }
 
   static void delaySeconds(double secs) {
+    if (Clock::virtual_time) return Clock::advance(secs * 1000000000.0);
     std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(secs * 1000) / Clock::time_multiplier);
   }
 
@@ -82,8 +87,32 @@ public:
     Clock::time_multiplier = tm;
   }
 
+  /**
+   * Virtual time: the clock only moves when the simulation advances it,
+   * and delays run the due timer callbacks instead of sleeping. This makes
+   * a headless run deterministic and as fast as the host allows.
+   */
+  static void setVirtualTime(bool enable) {
+    Clock::virtual_time = enable;
+    Clock::virtual_nanos = 0;
+  }
+
+  static bool isVirtualTime() {
+    return Clock::virtual_time;
+  }
+
+  // Move virtual time forward, firing any timers that fall due on the way
+  static void advance(uint64_t ns);
+
+  // Move virtual time to an absolute point without firing timers
+  static void setVirtualNanos(uint64_t ns) {
+    if (ns > Clock::virtual_nanos) Clock::virtual_nanos = ns;
+  }
+
 private:
   static std::chrono::nanoseconds startup;
   static uint32_t frequency;
   static double time_multiplier;
+  static bool virtual_time;
+  static uint64_t virtual_nanos;
 };
@@ -23,6 +23,7 @@
 
 #include <chrono>
 #include "Gpio.h"
+#include "StepTrace.h"
 
 class LinearAxis: public Peripheral {
 public:
@@ -30,6 +31,7 @@ public:
   virtual ~LinearAxis();
   void update();
   void interrupt(GpioEvent ev);
+  void attachTrace(StepTraceWriter* writer, uint8_t axis_id);
 
   pin_type enable_pin;
   pin_type dir_pin;
@@ -42,4 +44,6 @@ public:
   int32_t max_position;
   uint64_t last_update;
 
+  StepTraceWriter* trace;
+  uint8_t trace_axis;
 };
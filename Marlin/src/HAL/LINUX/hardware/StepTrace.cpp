@@ -0,0 +1,171 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include <deque>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "StepTrace.h"
+
+static const char trace_magic[4] = { 'M', 'S', 'T', '1' };
+
+StepTraceWriter::StepTraceWriter(std::string filename) {
+  file.open(filename, std::ios::binary);
+  file.write(trace_magic, sizeof(trace_magic));
+  length = 0;
+  last_timestamp = 0;
+}
+
+StepTraceWriter::~StepTraceWriter() {
+  flush();
+  file.close();
+}
+
+void StepTraceWriter::record(uint8_t axis, bool dir, uint64_t timestamp) {
+  if (length > sizeof(buffer) - 10) flush();
+  uint64_t value = ((timestamp - last_timestamp) << 3) | ((axis & 0x3) << 1) | dir;
+  last_timestamp = timestamp;
+  while (value >= 0x80) {
+    buffer[length++] = uint8_t(value) | 0x80;
+    value >>= 7;
+  }
+  buffer[length++] = uint8_t(value);
+}
+
+void StepTraceWriter::flush() {
+  file.write((const char*)buffer, length);
+  file.flush();
+  length = 0;
+}
+
+StepTraceReader::StepTraceReader(std::string filename) {
+  char magic[sizeof(trace_magic)] = {};
+  file.open(filename, std::ios::binary);
+  file.read(magic, sizeof(magic));
+  good = file.good() && !memcmp(magic, trace_magic, sizeof(magic));
+  length = index = 0;
+  last_timestamp = 0;
+}
+
+bool StepTraceReader::fill() {
+  file.read((char*)buffer, sizeof(buffer));
+  length = file.gcount();
+  index = 0;
+  return length > 0;
+}
+
+bool StepTraceReader::next(uint8_t &axis, bool &dir, uint64_t &timestamp) {
+  uint64_t value = 0;
+  for (uint8_t shift = 0;; shift += 7) {
+    if (index >= length && !fill()) return false;
+    const uint8_t b = buffer[index++];
+    value |= uint64_t(b & 0x7F) << shift;
+    if (!(b & 0x80)) break;
+  }
+  dir = value & 1;
+  axis = (value >> 1) & 0x3;
+  timestamp = last_timestamp += value >> 3;
+  return true;
+}
+
+bool stepTraceCompare(std::string a, std::string b, uint32_t max_steps, double max_drift_us) {
+  StepTraceReader reader[2] = { a, b };
+  if (!reader[0].valid() || !reader[1].valid()) {
+    printf("Not a step trace: %s\n", (reader[0].valid() ? b : a).c_str());
+    return false;
+  }
+
+  struct {
+    int32_t position[2];
+    uint32_t steps[2];
+    uint32_t max_divergence;
+    uint64_t max_divergence_at;
+    int64_t max_drift;
+    uint32_t max_drift_step;
+    std::deque<uint64_t> unmatched;     // Step times of the side that is ahead
+    uint8_t unmatched_side;
+  } axis[4] = {};
+
+  uint8_t ev_axis[2];
+  bool ev_dir[2], ev_valid[2];
+  uint64_t ev_time[2];
+  for (uint8_t s = 0; s < 2; s++) ev_valid[s] = reader[s].next(ev_axis[s], ev_dir[s], ev_time[s]);
+
+  // Positions are compared once all steps at the same instant are applied
+  uint64_t now = 0;
+  auto check_divergence = [&]() {
+    for (auto &ax : axis) {
+      const uint32_t divergence = abs(ax.position[0] - ax.position[1]);
+      if (divergence > ax.max_divergence) {
+        ax.max_divergence = divergence;
+        ax.max_divergence_at = now;
+      }
+    }
+  };
+
+  // Walk both traces in time order
+  while (ev_valid[0] || ev_valid[1]) {
+    const uint8_t s = (ev_valid[0] && (!ev_valid[1] || ev_time[0] <= ev_time[1])) ? 0 : 1;
+    auto &ax = axis[ev_axis[s]];
+
+    if (ev_time[s] != now) {
+      check_divergence();
+      now = ev_time[s];
+    }
+
+    ax.position[s] += ev_dir[s] ? 1 : -1;
+    ax.steps[s]++;
+
+    // Match the n-th step of one trace with the n-th step of the other
+    if (ax.unmatched.empty() || ax.unmatched_side == s) {
+      ax.unmatched.push_back(ev_time[s]);
+      ax.unmatched_side = s;
+    }
+    else {
+      const int64_t drift = s ? int64_t(ev_time[1] - ax.unmatched.front()) : int64_t(ax.unmatched.front() - ev_time[0]);
+      ax.unmatched.pop_front();
+      if (llabs(drift) > llabs(ax.max_drift)) {
+        ax.max_drift = drift;
+        ax.max_drift_step = ax.steps[s];
+      }
+    }
+
+    ev_valid[s] = reader[s].next(ev_axis[s], ev_dir[s], ev_time[s]);
+  }
+  check_divergence();
+
+  bool pass = true;
+  for (uint8_t i = 0; i < 4; i++) {
+    const auto &ax = axis[i];
+    if (!ax.steps[0] && !ax.steps[1]) continue;
+    const bool ok = ax.max_divergence <= max_steps && llabs(ax.max_drift) <= max_drift_us * 1000
+                    && uint32_t(abs(int32_t(ax.steps[0] - ax.steps[1]))) <= max_steps;
+    printf("%c: steps %u / %u, position %d / %d, divergence %u steps (at %.6f s), drift %+.3f us (step %u) %s\n",
+      "XYZE"[i], ax.steps[0], ax.steps[1], ax.position[0], ax.position[1],
+      ax.max_divergence, ax.max_divergence_at / 1e9, ax.max_drift / 1e3, ax.max_drift_step, ok ? "OK" : "FAIL");
+    if (!ok) pass = false;
+  }
+  return pass;
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,71 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Compact binary step/dir trace
+ *
+ * Each step is one varint: (nanoseconds since the previous step << 3) | (axis << 1) | dir
+ * after a 4-byte "MST1" header. A step every few microseconds costs 2-3 bytes,
+ * so a whole print can be recorded and compared against a golden trace.
+ */
+
+#include <fstream>
+#include <string>
+#include <stdint.h>
+
+class StepTraceWriter {
+public:
+  StepTraceWriter(std::string filename);
+  virtual ~StepTraceWriter();
+  void record(uint8_t axis, bool dir, uint64_t timestamp);
+  void flush();
+
+private:
+  std::ofstream file;
+  uint8_t buffer[64 * 1024];
+  uint32_t length;
+  uint64_t last_timestamp;
+};
+
+class StepTraceReader {
+public:
+  StepTraceReader(std::string filename);
+  bool valid() { return good; }
+  bool next(uint8_t &axis, bool &dir, uint64_t &timestamp);
+
+private:
+  bool fill();
+
+  std::ifstream file;
+  uint8_t buffer[64 * 1024];
+  uint32_t length, index;
+  uint64_t last_timestamp;
+  bool good;
+};
+
+/**
+ * Compare two traces and print, per axis, the step counts, final positions,
+ * the largest position divergence at any instant and the largest timing drift
+ * between corresponding steps. Returns true if both stay within the limits.
+ */
+bool stepTraceCompare(std::string a, std::string b, uint32_t max_steps=0, double max_drift_us=0);
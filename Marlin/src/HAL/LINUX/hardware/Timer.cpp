@@ -24,6 +24,10 @@
 #include "Timer.h"
 #include <stdio.h>
 
+Timer* Timer::instances[4] = {};
+uint8_t Timer::instance_count = 0;
+bool Timer::in_callback = false;
+
 Timer::Timer() {
   active = false;
   compare = 0;
@@ -34,10 +38,11 @@ Timer::Timer() {
   period = 0;
   start_time = 0;
   avg_error = 0;
+  deadline = UINT64_MAX;
 }
 
 Timer::~Timer() {
-  timer_delete(timerid);
+  if (timerid) timer_delete(timerid);
 }
 
 void Timer::init(uint32_t sig_id, uint32_t sim_freq, callback_fn* fn) {
@@ -47,6 +52,11 @@ void Timer::init(uint32_t sig_id, uint32_t sim_freq, callback_fn* fn) {
   frequency = sim_freq;
   cbfn = fn;
 
+  if (Clock::isVirtualTime()) {
+    if (instance_count < sizeof(instances) / sizeof(instances[0])) instances[instance_count++] = this;
+    return;
+  }
+
   sa.sa_flags = SA_SIGINFO;
   sa.sa_sigaction = Timer::handler;
   sigemptyset(&sa.sa_mask);
@@ -73,6 +83,7 @@ void Timer::start(uint32_t frequency) {
 }
 
 void Timer::enable() {
+  if (Clock::isVirtualTime()) { active = true; return; }
   if (sigprocmask(SIG_UNBLOCK, &mask, nullptr) == -1) {
     return; // todo: handle error
   }
@@ -81,6 +92,7 @@ void Timer::enable() {
 }
 
 void Timer::disable() {
+  if (Clock::isVirtualTime()) { active = false; return; }
   if (sigprocmask(SIG_SETMASK, &mask, nullptr) == -1) {
     return; // todo: handle error
   }
@@ -88,6 +100,14 @@ void Timer::disable() {
 }
 
 void Timer::setCompare(uint32_t compare) {
+  if (Clock::isVirtualTime()) {
+    // A zero compare disarms the timer, as timer_settime() does
+    this->compare = compare;
+    this->period = Clock::ticksToNanos(compare, frequency);
+    this->start_time = Clock::nanos();
+    this->deadline = period ? start_time + period : UINT64_MAX;
+    return;
+  }
   uint32_t nsec_offset = 0;
   if (active) {
     nsec_offset = Clock::nanos() - this->start_time; // calculate how long the timer would have been running for
@@ -114,4 +134,36 @@ uint32_t Timer::getCount() {
   return Clock::nanosToTicks(Clock::nanos() - this->start_time, frequency);
 }
 
+void Timer::fire() {
+  const uint64_t armed = deadline;
+  start_time = Clock::nanos();
+  in_callback = true;
+  cbfn();
+  in_callback = false;
+  // Periodic unless the callback reprogrammed the compare value
+  if (deadline == armed) deadline = period ? deadline + period : UINT64_MAX;
+}
+
+uint64_t Timer::nextDeadline() {
+  uint64_t next = UINT64_MAX;
+  for (uint8_t i = 0; i < instance_count; i++)
+    if (instances[i]->active && instances[i]->deadline < next) next = instances[i]->deadline;
+  return next;
+}
+
+void Timer::runUntil(uint64_t ns) {
+  // Timer callbacks are ISRs and don't preempt each other
+  if (!in_callback) for (;;) {
+    Timer *next = nullptr;
+    for (uint8_t i = 0; i < instance_count; i++) {
+      Timer * const t = instances[i];
+      if (t->active && t->deadline <= ns && (!next || t->deadline < next->deadline)) next = t;
+    }
+    if (!next) break;
+    Clock::setVirtualNanos(next->deadline);
+    next->fire();
+  }
+  Clock::setVirtualNanos(ns);
+}
+
 #endif // __PLAT_LINUX__
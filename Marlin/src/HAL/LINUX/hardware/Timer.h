@@ -52,6 +52,10 @@ public:
     return (*(intptr_t*)timerid);
   }
 
+  // Virtual time scheduling, see Clock::setVirtualTime()
+  static void runUntil(uint64_t ns);
+  static uint64_t nextDeadline();
+
   static void handler(int sig, siginfo_t *si, void *uc){
     Timer* _this = (Timer*)si->si_value.sival_ptr;
     _this->avg_error += (Clock::nanos() - _this->start_time) - _this->period; //high_resolution_clock is also limited in precision, but best we have
@@ -63,6 +67,12 @@ public:
   }
 
 private:
+  void fire();
+
+  static Timer* instances[4];
+  static uint8_t instance_count;
+  static bool in_callback;
+
   bool active;
   uint32_t compare;
   uint32_t frequency;
@@ -73,4 +83,5 @@ private:
   uint64_t period;
   uint64_t avg_error;
   uint64_t start_time;
+  uint64_t deadline;
 };
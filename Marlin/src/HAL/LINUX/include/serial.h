@@ -22,56 +22,54 @@
 #pragma once
 
 #include "../../../inc/MarlinConfigPre.h"
+#include "../../../core/spsc.h"
 #if ENABLED(EMERGENCY_PARSER)
   #include "../../../feature/e_parser.h"
 #endif
 
 #include <stdarg.h>
 #include <stdio.h>
+#include <thread>
 
 /**
  * Generic RingBuffer
  * T type of the buffer array
- * S size of the buffer (must be power of 2)
+ * S size of the buffer
  *
+ * Lock-free for one writer thread and one reader thread.
  */
 template <typename T, uint32_t S> class RingBuffer {
 public:
-  RingBuffer() { index_read = index_write = 0; }
-  uint32_t available() volatile { return index_write - index_read; }
-  uint32_t free() volatile      { return buffer_size - available(); }
-  bool empty() volatile         { return index_read == index_write; }
-  bool full() volatile          { return available() == buffer_size; }
-  void clear() volatile         { index_read = index_write = 0; }
+  uint32_t available() volatile { return ring.length(); }
+  uint32_t free() volatile      { return ring.free(); }
+  bool empty() volatile         { return ring.empty(); }
+  bool full() volatile          { return ring.full(); }
+  void clear() volatile         { ring.clear(); } // Reader side
 
   bool peek(T *value) volatile {
-    if (value == 0 || available() == 0)
+    if (value == 0 || empty())
       return false;
-    *value = buffer[mask(index_read)];
+    *value = buffer[ring.index_r()];
     return true;
   }
 
   int read() volatile {
     if (empty()) return -1;
-    return buffer[mask(index_read++)];
+    const T value = buffer[ring.index_r()];
+    ring.release();
+    return value;
   }
 
   bool write(T value) volatile {
     if (full()) return false;
-    buffer[mask(index_write++)] = value;
+    buffer[ring.index_w()] = value;
+    ring.commit();
     return true;
   }
 
 private:
-  uint32_t mask(uint32_t val) volatile {
-    return buffer_mask & val;
-  }
-
-  static const uint32_t buffer_size = S;
-  static const uint32_t buffer_mask = buffer_size - 1;
-  volatile T buffer[buffer_size];
-  volatile uint32_t index_write;
-  volatile uint32_t index_read;
+  volatile T buffer[S];
+  SPSCRing<S, uint32_t> ring;
 };
 
 class HalSerial {
@@ -103,7 +101,11 @@ public:
   operator bool() { return host_connected; }
 
   uint16_t available() {
-    return (uint16_t)receive_buffer.available();
+    const uint16_t count = receive_buffer.available();
+    #if DISABLED(MOTION_BENCHMARK)
+      if (!count) std::this_thread::yield(); // Let the reader thread run on a single-core host
+    #endif
+    return count;
   }
 
   void flush() { receive_buffer.clear(); }
@@ -23,6 +23,7 @@ extern void setup();
 extern void loop();
 
 #include <thread>
+#include <unistd.h>
 
 #include <iostream>
 #include <fstream>
@@ -35,23 +36,39 @@ extern void loop();
 #include "hardware/Heater.h"
 #include "hardware/LinearAxis.h"
 
+#if ENABLED(STEPPER_ISR_TIMING)
+  #include <signal.h>
+  #include "../../feature/isr_timing.h"
+#endif
+
+#if ENABLED(MOTION_BENCHMARK)
+  #include "selftest.h"
+#endif
+
 // simple stdout / stdin implementation for fake serial port
 void write_serial_thread() {
   for (;;) {
-    for (std::size_t i = usb_serial.transmit_buffer.available(); i > 0; i--) {
+    std::size_t count = usb_serial.transmit_buffer.available();
+    for (std::size_t i = count; i > 0; i--) {
       fputc(usb_serial.transmit_buffer.read(), stdout);
     }
-    std::this_thread::yield();
+    if (count) fflush(stdout); // A host on a pipe needs every reply
+    #if ENABLED(MOTION_BENCHMARK)
+      std::this_thread::sleep_for(std::chrono::microseconds(100)); // Leave the host CPU to the firmware
+    #else
+      std::this_thread::yield();
+    #endif
   }
 }
 
 void read_serial_thread() {
   char buffer[255] = {};
   for (;;) {
-    std::size_t len = _MIN(usb_serial.receive_buffer.free(), 254U);
-    if (fgets(buffer, len, stdin))
-      for (std::size_t i = 0; i < strlen(buffer); i++)
-        usb_serial.receive_buffer.write(buffer[i]);
+    // Read raw bytes, not lines, so binary transfers get through
+    const std::size_t len = _MIN(usb_serial.receive_buffer.free(), 254U);
+    const ssize_t count = len ? read(STDIN_FILENO, buffer, len) : 0;
+    for (ssize_t i = 0; i < count; i++)
+      usb_serial.receive_buffer.write(buffer[i]);
     std::this_thread::yield();
   }
 }
@@ -65,6 +82,15 @@ void simulation_loop() {
   LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
 
   //#define GPIO_LOGGING // Full GPIO and Positional Logging
+  //#define STEP_TRACE   // Compact binary step/dir trace (see hardware/StepTrace.h)
+
+  #ifdef STEP_TRACE
+    StepTraceWriter trace("step_trace.bin");
+    x_axis.attachTrace(&trace, X_AXIS);
+    y_axis.attachTrace(&trace, Y_AXIS);
+    z_axis.attachTrace(&trace, Z_AXIS);
+    extruder0.attachTrace(&trace, E_AXIS);
+  #endif
 
   #ifdef GPIO_LOGGING
     IOLoggerCSV logger("all_gpio_log.csv");
@@ -103,6 +129,138 @@ void simulation_loop() {
   }
 }
 
+#if ENABLED(MOTION_BENCHMARK)
+
+/**
+ * Headless benchmark: run the G-code file given on the command line
+ * in virtual time, then print the motion pipeline statistics.
+ *
+ *   program [--trace <out.trace>] <file.gcode>
+ *   program --compare <golden.trace> <new.trace> [<max steps> [<max drift us>]]
+ *   program --bresenham
+ *   program --arc          (NATIVE_ARCS)
+ *   program --preparse     (GCODE_PREPARSE)
+ *   program --packed       (PACKED_GCODE)
+ *   program --fixed-point  (PLANNER_FIXED_POINT)
+ *   program --thermistor   (THERMISTOR_INDEXED_LOOKUP)
+ *   program --eeprom       (EEPROM_SETTINGS)
+ *   program --g5           (BEZIER_CURVE_SUPPORT)
+ */
+int main(int argc, char *argv[]) {
+  const char * const program = argv[0];
+  if (argc >= 4 && !strcmp(argv[1], "--compare"))
+    return stepTraceCompare(argv[2], argv[3], argc > 4 ? atoi(argv[4]) : 0, argc > 5 ? atof(argv[5]) : 0) ? 0 : 2;
+
+  if (argc >= 2 && !strcmp(argv[1], "--bresenham"))
+    return SelfTest::bresenham();
+
+  #if ENABLED(NATIVE_ARCS)
+    if (argc >= 2 && !strcmp(argv[1], "--arc"))
+      return SelfTest::arc();
+  #endif
+
+  #if ENABLED(GCODE_PREPARSE)
+    if (argc >= 2 && !strcmp(argv[1], "--preparse"))
+      return SelfTest::preparse();
+  #endif
+
+  #if ENABLED(PACKED_GCODE)
+    if (argc >= 2 && !strcmp(argv[1], "--packed"))
+      return SelfTest::packed();
+  #endif
+
+  #if ENABLED(PLANNER_FIXED_POINT)
+    if (argc >= 2 && !strcmp(argv[1], "--fixed-point"))
+      return SelfTest::fixed_point();
+  #endif
+
+  #if ENABLED(THERMISTOR_INDEXED_LOOKUP)
+    if (argc >= 2 && !strcmp(argv[1], "--thermistor"))
+      return SelfTest::thermistor();
+  #endif
+
+  // Checks that run once the firmware is set up
+  const char * const check = argc >= 2 && (!strcmp(argv[1], "--eeprom") || !strcmp(argv[1], "--g5")) ? argv[1] : nullptr;
+
+  const char *trace_file = nullptr;
+  if (argc >= 3 && !strcmp(argv[1], "--trace")) {
+    trace_file = argv[2];
+    argc -= 2; argv += 2;
+  }
+
+  if (!check && (argc < 2 || !motion_bench.open(argv[1]))) {
+    fprintf(stderr, "Usage: %s [--trace <out.trace>] <file.gcode>\n"
+                    "       %s --compare <golden.trace> <new.trace> [<max steps> [<max drift us>]]\n"
+                    "       %s --bresenham | --arc | --preparse | --packed | --fixed-point | --thermistor | --eeprom | --g5\n", program, program, program);
+    return 1;
+  }
+
+  std::thread write_serial (write_serial_thread);
+  write_serial.detach();
+
+  MYSERIAL0.begin(BAUDRATE);
+
+  Clock::setFrequency(F_CPU);
+  Clock::setVirtualTime(true);
+
+  HAL_timer_init();
+
+  Heater hotend(HEATER_0_PIN, TEMP_0_PIN);
+  Heater bed(HEATER_BED_PIN, TEMP_BED_PIN);
+  LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN);
+  LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN);
+  LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
+  LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
+  motion_bench.attach(&hotend);
+  motion_bench.attach(&bed);
+
+  StepTraceWriter *trace = nullptr;
+  if (trace_file) {
+    trace = new StepTraceWriter(trace_file);
+    x_axis.attachTrace(trace, X_AXIS);
+    y_axis.attachTrace(trace, Y_AXIS);
+    z_axis.attachTrace(trace, Z_AXIS);
+    extruder0.attachTrace(trace, E_AXIS);
+  }
+
+  // Let the peripheral models settle, as the threaded simulation does
+  DELAY_US(10000);
+  hotend.update();
+  bed.update();
+
+  setup();
+
+  if (check) {
+    MYSERIAL0.flushTX();
+    #if ENABLED(EEPROM_SETTINGS)
+      if (!strcmp(check, "--eeprom")) return motion_bench.eeprom();
+    #endif
+    #if ENABLED(BEZIER_CURVE_SUPPORT)
+      if (!strcmp(check, "--g5")) return SelfTest::bezier();
+    #endif
+    fprintf(stderr, "%s is not enabled in this build\n", check);
+    return 1;
+  }
+
+  motion_bench.start();
+  do loop(); while (!motion_bench.finished());
+
+  delete trace;
+
+  TERN_(STEPPER_ISR_TIMING, isr_timing.report());
+  MYSERIAL0.flushTX();
+  motion_bench.report();
+  return 0;
+}
+
+#else
+
+#if ENABLED(STEPPER_ISR_TIMING)
+  // Print the stepper ISR timing before exiting on Ctrl-C or kill
+  static volatile sig_atomic_t exit_requested;
+  static void request_exit(int) { exit_requested = 1; }
+#endif
+
 int main() {
   std::thread write_serial (write_serial_thread);
   std::thread read_serial (read_serial_thread);
@@ -122,10 +280,22 @@ int main() {
 
   DELAY_US(10000);
 
+  #if ENABLED(STEPPER_ISR_TIMING)
+    signal(SIGINT, request_exit);
+    signal(SIGTERM, request_exit);
+  #endif
+
   setup();
   for (;;) {
     loop();
     std::this_thread::yield();
+    #if ENABLED(STEPPER_ISR_TIMING)
+      if (exit_requested) {
+        isr_timing.report();
+        MYSERIAL0.flushTX();
+        exit(0);
+      }
+    #endif
   }
 
   simulation.join();
@@ -133,4 +303,6 @@ int main() {
   read_serial.join();
 }
 
+#endif // !MOTION_BENCHMARK
+
 #endif // __PLAT_LINUX__
@@ -0,0 +1,771 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(MOTION_BENCHMARK)
+
+/**
+ * Self-checks of optional kernels against the code they replace, run
+ * from the command line of the LINUX build. See main.cpp.
+ */
+
+#include "selftest.h"
+#include "benchmark.h"
+#include "../../module/planner.h"
+#include "../../module/stepper.h"
+#include "../../module/stepper/bresenham.h"
+#if EITHER(GCODE_PREPARSE, PACKED_GCODE)
+  #include "../../gcode/parser.h"
+#endif
+
+static uint64_t host_nanos() { return MotionBenchmark::host_nanos(); }
+
+// A fixed LCG, so every run checks the same cases
+static uint32_t random_state;
+
+static void random_start() { random_state = 12345; }
+
+// 24 random bits
+static uint32_t random_bits() {
+  random_state = random_state * 1103515245UL + 12345UL;
+  return random_state >> 8;
+}
+
+static uint32_t random_below(const uint32_t n) { return random_bits() % n; }
+
+static float random_float(const float lo, const float hi) { return lo + (hi - lo) * float(random_bits()) * (1.0f / (1UL << 24)); }
+
+/**
+ * Run the scalar and packed Bresenham kernels over the same pseudo-random
+ * blocks, check that they step identically, and report the host time per
+ * step event for each.
+ */
+int SelfTest::bresenham() {
+  constexpr uint16_t blocks = 2000;
+  constexpr uint32_t max_events = 50000;
+
+  random_start();
+
+  uint64_t scalar_ns = 0, swar_ns = 0, events = 0, steps = 0;
+  uint8_t masks[max_events];
+
+  for (uint16_t b = 0; b < blocks; b++) {
+    const uint32_t event_count = 1 + random_below(max_events);
+    xyze_ulong_t dividend;
+    LOOP_XYZE(i) dividend[i] = random_below(event_count + 1) << 1;
+    dividend[random_below(XYZE)] = event_count << 1;  // The axis with the most steps
+    const uint32_t divisor = event_count << 1;
+
+    xyze_long_t error;
+    LOOP_XYZE(i) error[i] = -int32_t(event_count);
+    uint64_t t0 = host_nanos();
+    for (uint32_t n = 0; n < event_count; n++) masks[n] = bresenham_step(error, dividend, divisor);
+    scalar_ns += host_nanos() - t0;
+
+    bresenham_swar_t swar;
+    swar.init(dividend, -int32_t(event_count));
+    uint32_t mismatch = event_count;
+    t0 = host_nanos();
+    for (uint32_t n = 0; n < event_count; n++) {
+      const uint8_t m = swar.step(divisor);
+      if (m != masks[n] && mismatch == event_count) mismatch = n;
+    }
+    swar_ns += host_nanos() - t0;
+
+    if (mismatch != event_count) {
+      printf("Bresenham mismatch in block %u at event %u\n", b, mismatch);
+      return 2;
+    }
+
+    events += event_count;
+    for (uint32_t n = 0; n < event_count; n++) steps += __builtin_popcount(masks[n]);
+  }
+
+  printf("\nBresenham kernels: %u blocks, %llu step events, %llu steps, identical\n", blocks, (unsigned long long)events, (unsigned long long)steps);
+  printf("  scalar          : %.3f ms total, %.2f ns per event\n", scalar_ns / 1e6, double(scalar_ns) / events);
+  printf("  packed (SWAR)   : %.3f ms total, %.2f ns per event\n", swar_ns / 1e6, double(swar_ns) / events);
+  return 0;
+}
+
+#if ENABLED(NATIVE_ARCS)
+
+  #include "../../module/stepper/arc.h"
+
+  /**
+   * Trace pseudo-random arc octants, built as Planner::buffer_arc() builds
+   * them, with the stepper's midpoint DDA. Compare every step event with
+   * the nearest step to the ideal point, moving one step along the circle
+   * per event, and check that each block ends exactly on its target.
+   */
+  int SelfTest::arc() {
+    constexpr uint16_t blocks = 2000;
+    constexpr uint32_t max_radius = 40000, max_divergence = 2;
+
+    random_start();
+    auto root = [](const int64_t v) {
+      if (v <= 0) return int32_t(0);
+      int64_t y = sqrt(double(v));
+      while (y > 0 && y * y - y >= v) y--;
+      while (y * y + y < v) y++;
+      return int32_t(y);
+    };
+
+    uint64_t host_ns = 0, events = 0;
+    uint32_t worst = 0, worst_block = 0;
+    uint8_t masks[max_radius];              // An octant has fewer events than its radius
+
+    for (uint16_t b = 0; b < blocks; b++) {
+      // Start and end angles from the slow axis, within one octant
+      const double r0 = 48 + random_below(max_radius - 48), side = random_below(2) ? 1 : -1,
+                   phi0 = side * M_PI / 4 * random_below(10001) / 10000, phi1 = side * M_PI / 4 * random_below(10001) / 10000;
+      const int32_t f0 = lround(r0 * sin(phi0)), y0 = lround(r0 * cos(phi0));
+      const int64_t R2 = sq(int64_t(f0)) + sq(int64_t(y0));
+      const double r = sqrt(double(R2));
+
+      int32_t diag = r * M_SQRT1_2 + 1;
+      while (diag > root(R2 - sq(int64_t(diag)))) diag--;
+
+      block_arc_t a;
+      a.f = f0;
+      a.f_end = constrain(int32_t(lround(r * sin(phi1))), -diag, diag);
+      a.y = root(R2 - sq(int64_t(f0)));
+      a.y_start = y0;
+      a.y_end = root(R2 - sq(int64_t(a.f_end)));
+      a.lo = R2 - sq(int64_t(f0)) - (sq(int64_t(a.y)) - a.y);
+      a.hi = sq(int64_t(a.y)) + a.y - (R2 - sq(int64_t(f0)));
+      a.r = lround(r);
+      a.ydir = a.y_end < a.y_start ? -1 : 1;
+      a.fast = X_AXIS;
+
+      const double travel = asin(a.f_end / r) - asin(f0 / r);
+      const uint32_t event_count = _MAX(uint32_t(lround(r * ABS(travel))), uint32_t(ABS(a.f_end - a.f)), uint32_t(ABS(a.y_end - a.y_start)));
+
+      // Run the kernel, then replay its steps against the ideal circle
+      arc_tracer_t tracer;
+      tracer.init(a, 0);
+      const uint64_t t0 = host_nanos();
+      for (uint32_t n = 0; n < event_count; n++) masks[n] = tracer.step(event_count - n);
+      host_ns += host_nanos() - t0;
+
+      const int8_t fdir = a.f_end < a.f ? -1 : 1;
+      int32_t f = a.f, y = a.y_start;
+      uint32_t block_worst = 0;
+      for (uint32_t n = 0; n < event_count; n++) {
+        if (TEST(masks[n], X_AXIS)) f += fdir;
+        if (TEST(masks[n], Y_AXIS)) y += a.ydir;
+        const double phi = asin(f0 / r) + (travel < 0 ? -1 : 1) * _MIN((n + 1) / r, ABS(travel));
+        NOLESS(block_worst, uint32_t(_MAX(ABS(f - int32_t(lround(r * sin(phi)))), ABS(y - int32_t(lround(r * cos(phi)))))));
+      }
+
+      if (f != a.f_end || y != a.y_end) {
+        printf("Arc block %u ends at %d,%d, not %d,%d\n", b, int(f), int(y), int(a.f_end), int(a.y_end));
+        return 2;
+      }
+      if (block_worst > worst) { worst = block_worst; worst_block = b; }
+      events += event_count;
+    }
+
+    const bool ok = worst <= max_divergence;
+    printf("\nArc DDA: %u blocks, %llu step events, all on target\n", blocks, (unsigned long long)events);
+    printf("  divergence from the ideal : %u steps (block %u) %s\n", worst, worst_block, ok ? "OK" : "FAIL");
+    printf("  midpoint DDA              : %.3f ms total, %.2f ns per event\n", host_ns / 1e6, double(host_ns) / events);
+    return ok ? 0 : 2;
+  }
+
+#endif // NATIVE_ARCS
+
+#if EITHER(GCODE_PREPARSE, PACKED_GCODE)
+
+  // What a handler sees of the parsed command
+  typedef struct {
+    char letter;
+    int codenum;
+    uint32_t bits;
+    float value[26];
+    char string[MAX_CMD_SIZE];
+  } parsed_command_t;
+
+  static void read_command(parsed_command_t &r) {
+    r = {};
+    r.letter = parser.command_letter;
+    r.codenum = parser.codenum;
+    LOOP_L_N(i, 26) if (parser.seen('A' + i)) {
+      SBI32(r.bits, i);
+      r.value[i] = parser.has_value() ? parser.value_float() : NAN;
+    }
+    if (parser.string_arg) strcpy(r.string, parser.string_arg);
+  }
+
+  static bool same_command(const parsed_command_t &e, const parsed_command_t &a, const bool with_string=true) {
+    bool same = e.letter == a.letter && e.bits == a.bits && (!with_string || !strcmp(e.string, a.string))
+             && (e.letter == '?' || e.codenum == a.codenum);
+    LOOP_L_N(j, 26) if (TEST32(e.bits, j) && memcmp(&e.value[j], &a.value[j], sizeof(float))) same = false;
+    return same;
+  }
+
+#endif
+
+#if ENABLED(GCODE_PREPARSE)
+
+  /**
+   * Run test lines the way the queue does, pre-parsed ahead of execution
+   * and then loaded, and check each against parse() at run time: the same
+   * command, parameters, values and (with GCODE_MOTION_MODES) implied moves.
+   * Then report the host time to dispatch and read the values of each.
+   */
+  int SelfTest::preparse() {
+    static const char * const lines[] = {
+      "G28", "G1 X10 Y20.5 Z0.3 E1.25 F1500", "N12 G1 X-1.5 Y+.5*77", "G1 E-2.5 F2400",
+      "M104 S210", "M117 Hello World", "G1 A1 B2 C3 D4 E5 F6 H7 I8 J9 K10", "M106 P1 S127.5",
+      "G1 X Y Z E F", "G1 E1 F2 Q3 R4 X5 Y6 Z7", "G1 X10 Y20",     // Letters on both sides of bit 16
+      #if ENABLED(GCODE_MOTION_MODES)
+        "G0 X5", "X6 Y7", "G80", "X8", "G1 X0", "Y3 E0.5", "G92 E0", "Z0.2",
+      #endif
+      "G4 P500", "T0", "M82", "G1X1Y2E3"
+    };
+    constexpr uint8_t count = COUNT(lines);
+
+    static char text[count][MAX_CMD_SIZE], queued[count][MAX_CMD_SIZE];
+    static GCodeParser::state_t state[count];
+    static parsed_command_t expected[count], actual[count];
+
+    // Parse each line at run time
+    TERN_(GCODE_MOTION_MODES, parser.cancel_motion_mode());
+    LOOP_L_N(i, count) { strcpy(text[i], lines[i]); parser.parse(text[i]); read_command(expected[i]); }
+
+    // Parse all lines ahead, as the queue does, then run them
+    TERN_(GCODE_MOTION_MODES, parser.cancel_motion_mode());
+    uint8_t preparsed = 0;
+    LOOP_L_N(i, count) { strcpy(queued[i], lines[i]); parser.preparse(queued[i], state[i]); }
+    LOOP_L_N(i, count) {
+      if (state[i].command_letter != '?') { parser.load(state[i]); preparsed++; }
+      else parser.parse(queued[i]);
+      read_command(actual[i]);
+    }
+
+    LOOP_L_N(i, count) {
+      if (!same_command(expected[i], actual[i])) {
+        printf("Pre-parse mismatch on line %u: %s\n", i, lines[i]);
+        return 2;
+      }
+    }
+
+    // Host time to get each command ready and read its values, as a handler would
+    constexpr uint16_t runs = 2000;
+    parsed_command_t r;
+    uint64_t t = host_nanos();
+    for (uint16_t n = 0; n < runs; n++) LOOP_L_N(i, count) { strcpy(text[i], lines[i]); parser.parse(text[i]); read_command(r); }
+    const uint64_t parse_ns = host_nanos() - t;
+    t = host_nanos();
+    for (uint16_t n = 0; n < runs; n++) LOOP_L_N(i, count) {
+      if (state[i].command_letter != '?') parser.load(state[i]); else { strcpy(queued[i], lines[i]); parser.parse(queued[i]); }
+      read_command(r);
+    }
+    const uint64_t load_ns = host_nanos() - t;
+
+    printf("\nG-code pre-parse: %u lines, %u pre-parsed, identical\n", count, preparsed);
+    printf("  parse at run time : %.1f ns per line\n", double(parse_ns) / (runs * count));
+    printf("  pre-parsed        : %.1f ns per line\n", double(load_ns) / (runs * count));
+    return 0;
+  }
+
+#endif // GCODE_PREPARSE
+
+#if ENABLED(PACKED_GCODE)
+
+  /**
+   * Pack each test line from its parsed text, as pack_gcode.py would, and
+   * check that the packed command parses to the same command, parameters
+   * and values. Then print the packed command back to text and check that
+   * it parses the same again. Also check that packed commands with a bad
+   * size or checksum, or for a command that takes a string, are refused.
+   * Then report the host time to parse and read the values of each form.
+   */
+  int SelfTest::packed() {
+    static const char * const lines[] = {
+      "G28", "G1 X10 Y20.5 Z0.3 E1.25 F1500", "G0 X-1.5 Y+.5", "G1 E-2.5 F2400", "M104 S210",
+      "G1 A1 B2 C3 D4 E5 F6 H7 I8 J9 K10", "G1 E1 F2 Q3 R4 X5 Y6 Z7", "G1 X Y Z E F", "M106 P1 S127.5",
+      "G2 X10 Y10 I5 J0", "M201 X3000 Y3000 Z100 E10000", "G1 X0.1 Y-0.001 Z123456.7", "G4 P500", "T0", "M82"
+    };
+    constexpr uint8_t count = COUNT(lines);
+
+    // Pack the parsed command: letter, code, subcode, then each parameter
+    auto pack = [](char (&frame)[MAX_CMD_SIZE]) {
+      uint8_t n = 2;
+      frame[0] = char(PACKED_GCODE_MARKER);
+      frame[n++] = parser.command_letter;
+      frame[n++] = char(parser.codenum & 0xFF);
+      frame[n++] = char(parser.codenum >> 8);
+      frame[n++] = char(TERN0(USE_GCODE_SUBCODES, parser.subcode));
+      LOOP_L_N(i, 26) if (parser.seen('A' + i)) {
+        if (parser.has_value()) {
+          const float f = parser.value_float();
+          frame[n++] = char(i | 0x80);
+          memcpy(&frame[n], &f, sizeof(f));
+          n += sizeof(f);
+        }
+        else
+          frame[n++] = char(i);
+      }
+      uint8_t checksum = 0;
+      for (uint8_t i = 2; i < n; i++) checksum ^= frame[i];
+      frame[n] = char(checksum);
+      frame[1] = char(n - 2);
+    };
+
+    // Print a parsed command as text again
+    auto unpack = [](const parsed_command_t &r, char (&text)[MAX_CMD_SIZE]) {
+      int n = sprintf(text, "%c%d", r.letter, r.codenum);
+      LOOP_L_N(i, 26) if (TEST32(r.bits, i))
+        n += isnan(r.value[i]) ? sprintf(&text[n], " %c", 'A' + i) : sprintf(&text[n], " %c%.9g", 'A' + i, double(r.value[i]));
+    };
+
+    static char text[count][MAX_CMD_SIZE], frames[count][MAX_CMD_SIZE];
+    static parsed_command_t expected[count];
+    parsed_command_t r;
+
+    TERN_(GCODE_MOTION_MODES, parser.cancel_motion_mode());
+    LOOP_L_N(i, count) {
+      strcpy(text[i], lines[i]);
+      parser.parse(text[i]);
+      read_command(expected[i]);
+      pack(frames[i]);
+
+      if (!parser.packed_valid(frames[i])) {
+        printf("Packed command refused for line %u: %s\n", i, lines[i]);
+        return 2;
+      }
+      parser.parse(frames[i]);
+      read_command(r);
+      if (!same_command(expected[i], r, false)) {   // The text parser may leave a string_arg that no handler reads
+        printf("Packed mismatch on line %u: %s\n", i, lines[i]);
+        return 2;
+      }
+
+      char again[MAX_CMD_SIZE];
+      unpack(r, again);
+      parser.parse(again);
+      read_command(r);
+      if (!same_command(expected[i], r, false)) {
+        printf("Unpacked mismatch on line %u: %s -> %s\n", i, lines[i], again);
+        return 2;
+      }
+    }
+
+    // Packed commands the firmware must refuse
+    static const char * const text_lines[] = { "M23 X", "M117 X", "M118 X", "M28 X", "M29", "M30 X", "M32 X", "M0 S1",
+                                               "M108", "M110 N5", "M112", "M410", "M810", "G53" };
+    for (const char * const line : text_lines) {
+      char frame[MAX_CMD_SIZE];
+      strcpy(text[0], line);
+      parser.parse(text[0]);
+      pack(frame);
+      if (parser.packed_valid(frame)) {
+        printf("Packed %.4s not refused\n", line);
+        return 2;
+      }
+    }
+    char bad[MAX_CMD_SIZE];
+    memcpy(bad, frames[1], sizeof(bad));
+    bad[2 + uint8_t(bad[1])] ^= 1;                       // Checksum
+    const bool bad_checksum = parser.packed_valid(bad);
+    memcpy(bad, frames[1], sizeof(bad));
+    bad[1] = char(0xFF);                                 // Longer than MAX_CMD_SIZE
+    const bool bad_size = parser.packed_valid(bad) || parser.packed_size(bad) != 0xFF + 3;
+    if (bad_checksum || bad_size) {
+      printf("Bad packed %s not refused\n", bad_checksum ? "checksum" : "size");
+      return 2;
+    }
+
+    // Host time to get each command ready and read its values, as a handler would
+    constexpr uint16_t runs = 2000;
+    uint64_t t = host_nanos();
+    for (uint16_t n = 0; n < runs; n++) LOOP_L_N(i, count) { strcpy(text[i], lines[i]); parser.parse(text[i]); read_command(r); }
+    const uint64_t text_ns = host_nanos() - t;
+    t = host_nanos();
+    for (uint16_t n = 0; n < runs; n++) LOOP_L_N(i, count) { parser.parse(frames[i]); read_command(r); }
+    const uint64_t packed_ns = host_nanos() - t;
+
+    printf("\nPacked G-code: %u lines, identical both ways, bad commands refused\n", count);
+    printf("  parse text   : %.1f ns per line\n", double(text_ns) / (runs * count));
+    printf("  parse packed : %.1f ns per line\n", double(packed_ns) / (runs * count));
+    return 0;
+  }
+
+#endif // PACKED_GCODE
+
+#if ENABLED(PLANNER_FIXED_POINT)
+
+  /**
+   * Check the fixed-point kernels against the float math they replace,
+   * over random blocks and junction speeds. Report the largest error of
+   * each result and fail if one is out of bounds.
+   */
+  int SelfTest::fixed_point() {
+    random_start();
+
+    constexpr uint32_t trials = 200000;
+    float rate_err = 0, speed_err = 0;
+    uint32_t steps_err = 0;
+    TERN_(S_CURVE_ACCELERATION, float cruise_err = 0);
+
+    for (uint32_t i = 0; i < trials; i++) {
+      // A block as _populate_block() would fill it
+      const float spm = random_float(5, 1600), mm = expf(random_float(logf(0.05f), logf(300))), speed = random_float(1, 300);
+      block_t b{};
+      b.step_event_count = _MAX(1, LROUND(mm * spm));
+      b.millimeters = b.step_event_count / spm;
+      b.nominal_speed_sqr = sq(speed);
+      b.nominal_rate = CEIL(b.step_event_count * speed / b.millimeters);
+      if (b.nominal_rate <= MINIMAL_STEP_RATE) { i--; continue; } // Both clamp the rates the same way
+      b.acceleration_steps_per_s2 = CEIL(random_float(100, 5000) * spm);
+      b.acceleration = b.acceleration_steps_per_s2 / spm;
+      b.accel_distance_sqr = to_speed_sqr(2 * b.acceleration * b.millimeters);
+      const float rate_per_speed = b.nominal_rate / speed;
+      b.rate_per_speed = rate_per_speed < 65535.0f ? uint32_t(rate_per_speed * 65536.0f) : UINT32_MAX;
+
+      // Reverse pass entry limit
+      const float exit_speed = random_float(0, speed), entry_speed = random_float(0, speed);
+      const float ref_entry = SQRT(Planner::max_allowable_speed_sqr(-b.acceleration, sq(exit_speed), b.millimeters));
+      NOLESS(speed_err, ABS(SQRT(from_speed_sqr(Planner::allowable_entry_speed_sqr(&b, to_speed_sqr(sq(exit_speed))))) - ref_entry));
+
+      Planner::calculate_trapezoid_for_block(&b, to_speed_sqr(sq(entry_speed)), to_speed_sqr(sq(exit_speed)));
+
+      // Rates as the float calculate_trapezoid_for_block() gets them. Errors past
+      // the one step/s of rounding are given as speed.
+      const uint32_t initial_rate = _MAX(uint32_t(CEIL(b.nominal_rate * (entry_speed / speed))), uint32_t(MINIMAL_STEP_RATE)),
+                     final_rate = _MAX(uint32_t(CEIL(b.nominal_rate * (exit_speed / speed))), uint32_t(MINIMAL_STEP_RATE));
+      NOLESS(rate_err, (ABS(float(b.initial_rate) - initial_rate) - 1) / rate_per_speed);
+      NOLESS(rate_err, (ABS(float(b.final_rate) - final_rate) - 1) / rate_per_speed);
+
+      // The float trapezoid for the same rates
+      const int32_t accel = b.acceleration_steps_per_s2;
+      uint32_t accelerate_steps = CEIL(Planner::estimate_acceleration_distance(b.initial_rate, b.nominal_rate, accel));
+      const uint32_t decelerate_steps = FLOOR(Planner::estimate_acceleration_distance(b.nominal_rate, b.final_rate, -accel));
+      int32_t plateau_steps = b.step_event_count - accelerate_steps - decelerate_steps;
+      TERN_(S_CURVE_ACCELERATION, uint32_t cruise_rate = b.nominal_rate);
+      if (plateau_steps < 0) {
+        accelerate_steps = _MIN(uint32_t(_MAX(CEIL(Planner::intersection_distance(b.initial_rate, b.final_rate, accel, b.step_event_count)), 0)), b.step_event_count);
+        plateau_steps = 0;
+        TERN_(S_CURVE_ACCELERATION, cruise_rate = _MIN(Planner::final_speed(b.initial_rate, accel, accelerate_steps), b.nominal_rate)); // Fixed-point limits it
+      }
+      NOLESS(steps_err, uint32_t(ABS(int32_t(b.accelerate_until - accelerate_steps))));
+      NOLESS(steps_err, uint32_t(ABS(int32_t(b.decelerate_after - (accelerate_steps + plateau_steps)))));
+      TERN_(S_CURVE_ACCELERATION, NOLESS(cruise_err, (ABS(float(b.cruise_rate) - cruise_rate) - 1) / rate_per_speed));
+    }
+
+    // Rates within the speed resolution above 256mm/s
+    constexpr float speed_lsb = 1.0f / 16;
+    const bool ok = speed_err <= 0.01f && rate_err <= speed_lsb && TERN1(S_CURVE_ACCELERATION, cruise_err <= speed_lsb) && steps_err <= 1;
+
+    printf("\nFixed-point planner kernels, %u random blocks\n", unsigned(trials));
+    printf("  allowed entry speed  %8.4f mm/s\n", speed_err);
+    printf("  entry / exit rate    %8.4f mm/s\n", rate_err);
+    TERN_(S_CURVE_ACCELERATION, printf("  cruise rate          %8.4f mm/s\n", cruise_err));
+    printf("  accel / decel point  %8u steps\n", unsigned(steps_err));
+    printf("%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 2;
+  }
+
+#endif // PLANNER_FIXED_POINT
+
+#if ENABLED(THERMISTOR_INDEXED_LOOKUP)
+
+  #include "../../module/temperature.h"
+
+  // The stock bisect search of a table, for reference and timing
+  static float scan_table(const temp_entry_t * const tbl, const uint8_t len, const int raw) {
+    uint8_t l = 0, r = len, m;
+    for (;;) {
+      m = (l + r) >> 1;
+      if (!m) return int16_t(pgm_read_word(&tbl[0].celsius));
+      if (m == l || m == r) return int16_t(pgm_read_word(&tbl[len - 1].celsius));
+      const int16_t v00 = pgm_read_word(&tbl[m - 1].value), v10 = pgm_read_word(&tbl[m].value);
+           if (raw < v00) r = m;
+      else if (raw > v10) l = m;
+      else {
+        const int16_t v01 = pgm_read_word(&tbl[m - 1].celsius), v11 = pgm_read_word(&tbl[m].celsius);
+        return v01 + (raw - v00) * float(v11 - v01) / float(v10 - v00);
+      }
+    }
+  }
+
+  /**
+   * Check the analog_to_celsius_* conversions against the bisect search
+   * for every raw value of each thermistor table in this build. They must
+   * agree within 0.1°C. Also report the host time per conversion for each.
+   */
+  int SelfTest::thermistor() {
+    constexpr int raw_max = MAX_RAW_THERMISTOR_VALUE;
+    bool ok = true;
+
+    auto check = [&ok, raw_max](const char * const name, const temp_entry_t * const tbl, const uint8_t len, float (*convert)(const int)) {
+      float max_diff = 0;
+      int worst = 0;
+      for (int raw = 0; raw <= raw_max; raw++) {
+        const float diff = ABS(convert(raw) - scan_table(tbl, len, raw));
+        if (diff > max_diff) { max_diff = diff; worst = raw; }
+      }
+
+      volatile float sink = 0;
+      uint64_t t = host_nanos();
+      for (int raw = 0; raw <= raw_max; raw++) sink = scan_table(tbl, len, raw);
+      const uint64_t scan_ns = host_nanos() - t;
+      t = host_nanos();
+      for (int raw = 0; raw <= raw_max; raw++) sink = convert(raw);
+      const uint64_t convert_ns = host_nanos() - t;
+      UNUSED(sink);
+
+      const bool table_ok = max_diff <= 0.1f;
+      printf("  %-10s %8.3f C at %5d %10.1f ns %10.1f ns%s\n", name, max_diff, worst,
+        double(scan_ns) / (raw_max + 1), double(convert_ns) / (raw_max + 1), table_ok ? "" : "  FAILED");
+      ok &= table_ok;
+    };
+
+    #define _TT_CHECK(N, F) check(#N, N##_TEMPTABLE, N##_TEMPTABLE_LEN, [](const int raw) { return thermalManager.F; })
+    #define _TT_CHECK_HOTEND(N) _TT_CHECK(HEATER_##N, analog_to_celsius_hotend(raw, N))
+
+    printf("\nThermistor tables, raw 0-%d\n", raw_max);
+    printf("  %-10s %18s %13s %13s\n", "table", "max difference", "bisect", "indexed");
+    #if ENABLED(HEATER_0_USES_THERMISTOR)
+      _TT_CHECK_HOTEND(0);
+    #endif
+    #if ENABLED(HEATER_1_USES_THERMISTOR) && HOTENDS > 1
+      _TT_CHECK_HOTEND(1);
+    #endif
+    #if ENABLED(HEATER_2_USES_THERMISTOR) && HOTENDS > 2
+      _TT_CHECK_HOTEND(2);
+    #endif
+    #if ENABLED(HEATER_3_USES_THERMISTOR) && HOTENDS > 3
+      _TT_CHECK_HOTEND(3);
+    #endif
+    #if ENABLED(HEATER_4_USES_THERMISTOR) && HOTENDS > 4
+      _TT_CHECK_HOTEND(4);
+    #endif
+    #if ENABLED(HEATER_5_USES_THERMISTOR) && HOTENDS > 5
+      _TT_CHECK_HOTEND(5);
+    #endif
+    #if ENABLED(HEATER_6_USES_THERMISTOR) && HOTENDS > 6
+      _TT_CHECK_HOTEND(6);
+    #endif
+    #if ENABLED(HEATER_7_USES_THERMISTOR) && HOTENDS > 7
+      _TT_CHECK_HOTEND(7);
+    #endif
+    #if ENABLED(HEATER_BED_USES_THERMISTOR)
+      _TT_CHECK(BED, analog_to_celsius_bed(raw));
+    #endif
+    #if ENABLED(HEATER_CHAMBER_USES_THERMISTOR)
+      _TT_CHECK(CHAMBER, analog_to_celsius_chamber(raw));
+    #endif
+    #if ENABLED(PROBE_USES_THERMISTOR)
+      _TT_CHECK(PROBE, analog_to_celsius_probe(raw));
+    #endif
+    #undef _TT_CHECK_HOTEND
+    #undef _TT_CHECK
+
+    return ok ? 0 : 2;
+  }
+
+#endif // THERMISTOR_INDEXED_LOOKUP
+
+#if ENABLED(BEZIER_CURVE_SUPPORT)
+
+  #include <vector>
+  #include "../../module/planner_bezier.h"
+
+  /**
+   * Flatten test curves and check that the lines stay within
+   * BEZIER_TOLERANCE of the true curve, sampled densely. Report the
+   * lines emitted and the largest distance from the curve for each.
+   */
+  int SelfTest::bezier() {
+    static const struct { xy_pos_t start, end, offsets[2]; } curves[] = {
+      { {   0,   0 }, { 100,     0 }, { {  30,  60 }, {  -30,  60 } } },   // Symmetric arch
+      { {  10,  10 }, {  60,    60 }, { {  40,   0 }, {    0, -40 } } },   // Quarter circle
+      { {   0,   0 }, {  50,     0 }, { { 100, 100 }, { -100, 100 } } },   // Tight loop
+      { { 100, 100 }, { 100.5, 100.5 }, { { 2, 0 }, { 0, -2 } } },         // Tiny curl
+      { {   0,   0 }, { 200,     0 }, { {  50,   0 }, {  -50,   0 } } },   // Straight line
+      { {   0,   0 }, { 200,   200 }, { { 150, -80 }, {   60,  90 } } },   // S-bend
+      { { 150, 150 }, { 160,   150 }, { {   1,   1 }, {   -1,   1 } } }    // Shallow bump
+    };
+    constexpr uint32_t samples = 20000;
+    constexpr float tolerance = BEZIER_TOLERANCE;
+
+    std::vector<xy_pos_t> lines;
+    bool ok = true;
+
+    printf("\nG5 flattening, tolerance %.3f mm\n", double(tolerance));
+    printf("  %-6s %8s %14s\n", "curve", "lines", "max error mm");
+
+    LOOP_L_N(n, COUNT(curves)) {
+      const auto &c = curves[n];
+
+      // Collect the lines, relative to the start
+      lines.clear();
+      bezier_flatten(c.end - c.start, c.offsets, [](const xy_pos_t &to, const float, void * const arg) {
+        ((std::vector<xy_pos_t>*)arg)->push_back(to);
+        return true;
+      }, &lines);
+
+      // The distance from each sample of the true curve to the nearest line
+      const xy_pos_t p0 = c.start, p1 = c.start + c.offsets[0], p2 = c.end + c.offsets[1], p3 = c.end;
+      double max_error = 0;
+      for (uint32_t k = 0; k <= samples; k++) {
+        const double u = double(k) / samples, v = 1 - u,
+                     b0 = v * v * v, b1 = 3 * v * v * u, b2 = 3 * v * u * u, b3 = u * u * u,
+                     x = b0 * p0.x + b1 * p1.x + b2 * p2.x + b3 * p3.x,
+                     y = b0 * p0.y + b1 * p1.y + b2 * p2.y + b3 * p3.y;
+        double nearest = INFINITY;
+        xy_pos_t a = c.start;
+        for (const xy_pos_t &to : lines) {
+          const xy_pos_t b = c.start + to;
+          const double dx = b.x - a.x, dy = b.y - a.y, len_sq = dx * dx + dy * dy,
+                       t = len_sq ? constrain(((x - a.x) * dx + (y - a.y) * dy) / len_sq, 0.0, 1.0) : 0.0;
+          nearest = _MIN(nearest, hypot(x - a.x - t * dx, y - a.y - t * dy));
+          a = b;
+        }
+        max_error = _MAX(max_error, nearest);
+      }
+
+      const bool curve_ok = !lines.empty() && max_error <= tolerance + 1e-4 && lines.back() == c.end - c.start;
+      printf("  %-6u %8u %14.4f%s\n", n + 1, unsigned(lines.size()), max_error, curve_ok ? "" : "  FAILED");
+      ok &= curve_ok;
+    }
+
+    return ok ? 0 : 2;
+  }
+
+#endif // BEZIER_CURVE_SUPPORT
+
+#if ENABLED(EEPROM_TAGGED_SETTINGS)
+
+  #include <vector>
+  #include "../shared/eeprom_api.h"
+  #include "../../module/settings.h"
+  #include "../../module/temperature.h"
+
+  /**
+   * Save distinctive settings, then rewrite the store as a build with one
+   * more, then one fewer, E stepper would have saved them. Each must load
+   * with the shared E entries and every later group intact, and the E
+   * stepper missing from the store must get its defaults.
+   */
+  bool SelfTest::eeprom_esteppers() {
+    constexpr uint8_t esteppers = COUNT(planner.settings.axis_steps_per_mm) - XYZ;
+    constexpr uint16_t header = 4 + sizeof(uint16_t);   // Version and CRC
+
+    // The records that end with an array sized by esteppers
+    constexpr uint16_t e_tags[] = {
+      MarlinSettings::record_tag("esteppers"),
+      MarlinSettings::record_tag("planner_settings.min_segment_time_us"),
+      MarlinSettings::record_tag("planner_settings.max_feedrate_mm_s")
+    };
+
+    const uint16_t size = settings.datasize();
+    const size_t capacity = persistentStore.capacity() - settings.store_offset();
+    std::vector<uint8_t> saved(capacity), changed(capacity + COUNT(e_tags) * sizeof(float)), loaded(size), expected(size);
+
+    settings.reset();
+    const planner_settings_t defaults = planner.settings;
+
+    auto distinct = []{
+      LOOP_XYZE_N(i) {
+        planner.settings.max_acceleration_mm_per_s2[i] = 1000 + i;
+        planner.settings.axis_steps_per_mm[i] = 80.5f + i;
+        planner.settings.max_feedrate_mm_s[i] = 100.25f + i;
+      }
+      planner.settings.min_segment_time_us = 12345;
+      planner.settings.acceleration = 678;
+      planner.settings.min_travel_feedrate_mm_s = 1.5f;
+      TERN_(HAS_CLASSIC_JERK, planner.max_jerk.x = 7.5f);
+      TERN_(HAS_JUNCTION_DEVIATION, planner.junction_deviation_mm = 0.031f);
+      TERN_(PIDTEMP, PID_PARAM(Kp, 0) = 21.5f);
+      TERN_(PIDTEMPBED, thermalManager.temp_bed.pid.Kp = 123.5f);
+    };
+
+    distinct();
+    if (!settings.save()) return false;
+
+    int pos = settings.store_offset();
+    persistentStore.access_start();
+    const bool read_error = persistentStore.read_data(pos, saved.data(), capacity);
+    persistentStore.access_finish();
+    if (read_error) return false;
+
+    bool ok = true;
+    for (const int8_t delta : { 1, -1 }) {
+      // Copy the records, giving the per-E arrays one more or one fewer entry
+      uint16_t in = header, out = header;
+      for (;;) {
+        uint16_t head[2];
+        memcpy(head, &saved[in], sizeof(head));
+        in += sizeof(head);
+        const uint16_t stored = head[1];
+        for (const uint16_t tag : e_tags) if (head[0] == tag) head[1] += delta * int8_t(sizeof(float));
+        memcpy(&changed[out], head, sizeof(head));
+        out += sizeof(head);
+        if (!head[0]) break;
+        memcpy(&changed[out], &saved[in], _MIN(stored, head[1]));
+        if (head[1] > stored) memset(&changed[out + stored], 0x55, head[1] - stored);
+        if (head[0] == e_tags[0]) changed[out] = esteppers + delta;
+        in += stored;
+        out += head[1];
+      }
+      uint16_t crc = 0;
+      crc16(&crc, &changed[header], out - header);
+      memcpy(changed.data(), saved.data(), 4);
+      memcpy(&changed[4], &crc, sizeof(crc));
+
+      pos = settings.store_offset();
+      persistentStore.access_start();
+      const bool write_error = persistentStore.write_data(pos, changed.data(), out) || !persistentStore.access_finish();
+
+      settings.reset();
+      const bool load_ok = !write_error && settings.load();
+      settings.stage_image(loaded.data());
+
+      distinct();
+      if (delta < 0) {
+        planner.settings.max_acceleration_mm_per_s2[XYZE_N - 1] = defaults.max_acceleration_mm_per_s2[XYZE_N - 1];
+        planner.settings.axis_steps_per_mm[XYZE_N - 1] = defaults.axis_steps_per_mm[XYZE_N - 1];
+        planner.settings.max_feedrate_mm_s[XYZE_N - 1] = defaults.max_feedrate_mm_s[XYZE_N - 1];
+      }
+      settings.stage_image(expected.data());
+
+      int diff = -1;
+      for (uint16_t i = header; i < size && diff < 0; i++)
+        if (loaded[i] != expected[i]) diff = i;
+
+      printf("Load with %u E steppers into %u: %s", unsigned(esteppers + delta), unsigned(esteppers), !load_ok ? "FAILED" : diff < 0 ? "OK" : "MISMATCH");
+      if (load_ok && diff >= 0) printf(" at byte %d", diff);
+      printf("\n");
+      ok &= load_ok && diff < 0;
+    }
+    return ok;
+  }
+
+#endif // EEPROM_TAGGED_SETTINGS
+
+#endif // MOTION_BENCHMARK
+#endif // __PLAT_LINUX__
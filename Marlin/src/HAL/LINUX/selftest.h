@@ -0,0 +1,57 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Self-checks for the LINUX build
+ *
+ * Each one runs an optional kernel against the code it replaces, or
+ * against a reference, and returns 0 when they agree.
+ */
+
+#include <stdint.h>
+
+class SelfTest {
+public:
+  static int bresenham();
+  #if ENABLED(NATIVE_ARCS)
+    static int arc();
+  #endif
+  #if ENABLED(GCODE_PREPARSE)
+    static int preparse();
+  #endif
+  #if ENABLED(PACKED_GCODE)
+    static int packed();
+  #endif
+  #if ENABLED(PLANNER_FIXED_POINT)
+    static int fixed_point();
+  #endif
+  #if ENABLED(THERMISTOR_INDEXED_LOOKUP)
+    static int thermistor();
+  #endif
+  #if ENABLED(BEZIER_CURVE_SUPPORT)
+    static int bezier();
+  #endif
+  #if ENABLED(EEPROM_TAGGED_SETTINGS)
+    static bool eeprom_esteppers();
+  #endif
+};
@@ -225,6 +225,12 @@
   #include "feature/password/password.h"
 #endif
 
+#if ENABLED(IDLE_TASK_SCHEDULER)
+  #include "feature/idle_tasks.h"
+#else
+  #define IDLE_TASK(T, F) F
+#endif
+
 PGMSTR(NUL_STR, "");
 PGMSTR(M112_KILL_STR, "M112 Shutdown");
 PGMSTR(G28_STR, "G28");
@@ -491,7 +497,7 @@ void startOrResumeJob() {
  */
 inline void manage_inactivity(const bool ignore_stepper_queue=false) {
 
-  if (queue.length < BUFSIZE) queue.get_available_commands();
+  if (!queue.ring.full()) queue.get_available_commands();
 
   const millis_t ms = millis();
 
@@ -685,6 +691,7 @@ inline void manage_inactivity(const bool ignore_stepper_queue=false) {
  *  - Max7219 heartbeat, animation, etc.
  *
  *  Only after setup() is complete:
+ *  - Prepare the stepper start state of the next blocks
  *  - Handle filament runout sensors
  *  - Run HAL idle tasks
  *  - Handle Power-Loss Recovery
@@ -703,19 +710,22 @@ inline void manage_inactivity(const bool ignore_stepper_queue=false) {
 void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
 
   // Core Marlin activities
-  manage_inactivity(TERN_(ADVANCED_PAUSE_FEATURE, no_stepper_sleep));
+  IDLE_TASK(INACTIVITY, manage_inactivity(TERN_(ADVANCED_PAUSE_FEATURE, no_stepper_sleep)));
 
   // Manage Heaters (and Watchdog)
-  thermalManager.manage_heater();
+  IDLE_TASK(HEATERS, thermalManager.manage_heater());
 
   // Max7219 heartbeat, animation, etc
-  TERN_(MAX7219_DEBUG, max7219.idle_tasks());
+  TERN_(MAX7219_DEBUG, IDLE_TASK(LEDS, max7219.idle_tasks()));
 
   // Return if setup() isn't completed
   if (marlin_state == MF_INITIALIZING) return;
 
+  // Prepare the stepper start state of the next blocks
+  TERN_(STEPPER_BLOCK_PREP, stepper.prepare_blocks());
+
   // Handle filament runout sensors
-  TERN_(HAS_FILAMENT_SENSOR, runout.run());
+  TERN_(HAS_FILAMENT_SENSOR, IDLE_TASK(RUNOUT, runout.run()));
 
   // Run HAL idle tasks
   #ifdef HAL_IDLETASK
@@ -736,23 +746,30 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
   #endif
 
   // Handle SD Card insert / remove
-  TERN_(SDSUPPORT, card.manage_media());
+  TERN_(SDSUPPORT, IDLE_TASK(MEDIA, card.manage_media()));
+
+  // Read ahead in the file being printed
+  #ifdef SD_READ_AHEAD
+    IDLE_TASK(READ_AHEAD, card.read_ahead());
+  #endif
 
   // Handle USB Flash Drive insert / remove
   TERN_(USB_FLASH_DRIVE_SUPPORT, Sd2Card::idle());
 
   // Announce Host Keepalive state (if any)
-  TERN_(HOST_KEEPALIVE_FEATURE, gcode.host_keepalive());
+  TERN_(HOST_KEEPALIVE_FEATURE, IDLE_TASK(KEEPALIVE, gcode.host_keepalive()));
 
   // Update the Print Job Timer state
-  TERN_(PRINTCOUNTER, print_job_timer.tick());
+  TERN_(PRINTCOUNTER, IDLE_TASK(PRINT_TIMER, print_job_timer.tick()));
 
   // Update the Beeper queue
-  TERN_(USE_BEEPER, buzzer.tick());
+  TERN_(USE_BEEPER, IDLE_TASK(BEEPER, buzzer.tick()));
 
   // Handle UI input / draw events
-  TERN(DWIN_CREALITY_LCD, DWIN_Update(), ui.update());
-  TERN_(DWIN_CREALITY_TOUCHLCD, DWINTouch_refresh());
+  IDLE_TASK(UI, {
+    TERN(DWIN_CREALITY_LCD, DWIN_Update(), ui.update());
+    TERN_(DWIN_CREALITY_TOUCHLCD, DWINTouch_refresh());
+  });
 
   #if ENABLED(FIX_MOUNTED_PROBE)
     if((IS_SD_PRINTING() == true) && home_flag == false) //  printing and no homing
@@ -784,10 +801,10 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
 
   // Auto-report Temperatures / SD Status
   #if HAS_AUTO_REPORTING
-    if (!gcode.autoreport_paused) {
+    if (!gcode.autoreport_paused) IDLE_TASK(AUTO_REPORT, {
       TERN_(AUTO_REPORT_TEMPERATURES, thermalManager.auto_report_temperatures());
       TERN_(AUTO_REPORT_SD_STATUS, card.auto_report_sd_status());
-    }
+    });
   #endif
 
   // Update the Průša MMU2
@@ -800,7 +817,7 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
   TERN_(DIRECT_STEPPING, page_manager.write_responses());
 
   #if HAS_TFT_LVGL_UI
-    LV_TASK_HANDLER();
+    IDLE_TASK(LVGL, LV_TASK_HANDLER());
   #endif
 }
 
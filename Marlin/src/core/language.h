@@ -116,6 +116,8 @@
 #define STR_FILE_SAVED                      "Done saving file."
 #define STR_ERR_LINE_NO                     "Line Number is not Last Line Number+1, Last Line: "
 #define STR_ERR_CHECKSUM_MISMATCH           "checksum mismatch, Last Line: "
+#define STR_ERR_PACKED_GCODE                "Bad packed command"
+#define STR_ERR_PACKED_LINE                 STR_ERR_PACKED_GCODE ", Last Line: "
 #define STR_ERR_NO_CHECKSUM                 "No Checksum with line number, Last Line: "
 #define STR_FILE_PRINTED                    "Done printing file"
 #define STR_NO_MEDIA                        "No media"
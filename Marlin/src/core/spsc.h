@@ -0,0 +1,80 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * spsc.h - Lock-free single-producer / single-consumer ring positions
+ *
+ * The producer owns the write position and the consumer owns the read
+ * position. Each side publishes its own position with a release store
+ * and reads the other side's position with an acquire load, so data
+ * written into a slot before commit() is visible to the consumer once it
+ * sees the slot in length(), and a slot is only reused after release().
+ *
+ * Positions run over [0, 2*S) so a full ring can be told from an empty
+ * one without giving up a slot, and S need not be a power of 2.
+ * The storage for the slots is left to the owner of the ring.
+ */
+
+#include <stdint.h>
+
+#ifndef FORCE_INLINE
+  #define FORCE_INLINE __attribute__((always_inline)) inline
+#endif
+
+template<typename T> FORCE_INLINE T load_acquire(const volatile T &v) { return __atomic_load_n(&v, __ATOMIC_ACQUIRE); }
+template<typename T> FORCE_INLINE void store_release(volatile T &v, const T val) { __atomic_store_n(&v, val, __ATOMIC_RELEASE); }
+
+template<uint32_t S, typename I=uint8_t>
+class SPSCRing {
+  static_assert(2 * uint64_t(S) - 1 <= I(~I(0)), "SPSCRing index type is too small for the ring size.");
+public:
+  SPSCRing() { pos_r = pos_w = 0; }
+
+  static constexpr I size() { return I(S); }
+
+  // Either side
+  I length() const volatile {
+    const I w = load_acquire(pos_w), r = load_acquire(pos_r);
+    return w >= r ? w - r : I(2 * S - r + w);
+  }
+  bool empty() const volatile { return load_acquire(pos_w) == load_acquire(pos_r); }
+  bool full()  const volatile { return length() >= S; }
+  I free()     const volatile { return S - length(); }
+
+  // Producer: fill slot index_w(), then commit() to hand it over
+  I index_w() const volatile { return slot(pos_w); }
+  void commit() volatile { store_release(pos_w, next(pos_w)); }
+
+  // Consumer: use slot index_r(), then release() to hand it back
+  I index_r() const volatile { return slot(pos_r); }
+  void release() volatile { store_release(pos_r, next(pos_r)); }
+
+  // Consumer: drop everything committed so far
+  void clear() volatile { store_release(pos_r, load_acquire(pos_w)); }
+
+private:
+  static FORCE_INLINE I slot(const I p) { return p < S ? p : I(p - S); }
+  static FORCE_INLINE I next(const I p) { return p < 2 * S - 1 ? I(p + 1) : I(0); }
+
+  volatile I pos_w, pos_r;
+};
@@ -33,4 +33,9 @@ bool SDFileTransferProtocol::transfer_active, SDFileTransferProtocol::dummy_tran
 
 BinaryStream binaryStream[NUM_SERIAL];
 
+#ifdef BINARY_STREAM_BUFFERS
+  BinaryStream::Slot BinaryStream::slot[BINARY_STREAM_BUFFERS];
+  uint8_t BinaryStream::slot_head, BinaryStream::slot_count;
+#endif
+
 #endif
@@ -49,9 +49,15 @@ inline int bs_read_serial(const uint8_t index) {
   return -1;
 }
 
+#ifdef BINARY_STREAM_BUFFERS
+  // Collect the file data for multiple-block writes
+  static uint8_t decode_buffer[(BINARY_STREAM_BUFFERS) * 512] = {};
+#elif ENABLED(BINARY_STREAM_COMPRESSION)
+  static uint8_t decode_buffer[512] = {};
+#endif
+
 #if ENABLED(BINARY_STREAM_COMPRESSION)
   static heatshrink_decoder hsd;
-  static uint8_t decode_buffer[512] = {};
 #endif
 
 class SDFileTransferProtocol  {
@@ -110,12 +116,26 @@ private:
         return true;
       }
     #endif
-    return (dummy_transfer || card.write(buffer, length) >= 0);
+    #ifdef BINARY_STREAM_BUFFERS
+      // Write whole blocks, several at a time
+      for (size_t n, done = 0; done < length; done += n) {
+        n = _MIN(length - done, sizeof(decode_buffer) - data_waiting);
+        memcpy(&decode_buffer[data_waiting], &buffer[done], n);
+        data_waiting += n;
+        if (data_waiting == sizeof(decode_buffer)) {
+          if (!dummy_transfer && card.write(decode_buffer, data_waiting) < 0) return false;
+          data_waiting = 0;
+        }
+      }
+      return true;
+    #else
+      return (dummy_transfer || card.write(buffer, length) >= 0);
+    #endif
   }
 
   static bool file_close() {
     if (!dummy_transfer) {
-      #if ENABLED(BINARY_STREAM_COMPRESSION)
+      #if ENABLED(BINARY_STREAM_COMPRESSION) || defined(BINARY_STREAM_BUFFERS)
         // flush any buffered data
         if (data_waiting) {
           if (card.write(decode_buffer, data_waiting) < 0) return false;
@@ -296,6 +316,13 @@ public:
     uint8_t data = 0;
     millis_t transfer_window = millis() + RX_TIMESLICE;
 
+    #ifdef BINARY_STREAM_BUFFERS
+      UNUSED(buffer);
+      constexpr size_t packet_size = BINARY_STREAM_PACKET_SIZE;
+    #else
+      constexpr size_t packet_size = buffer_size;
+    #endif
+
     #if ENABLED(SDSUPPORT)
       PORT_REDIRECT(card.transfer_port_index);
     #endif
@@ -312,7 +339,13 @@ public:
           packet.reset();
           stream_state = StreamState::PACKET_WAIT;
         case StreamState::PACKET_WAIT:
-          if (!stream_read(data)) { idle(); return; }  // no active packet so don't wait
+          if (!stream_read(data)) {                       // no active packet so don't wait
+            #ifdef BINARY_STREAM_BUFFERS
+              dispatch_buffered();                        // the host has paused, catch up
+            #endif
+            idle();
+            return;
+          }
           packet.header.data[1] = data;
           if (packet.header.token == packet.header.HEADER_TOKEN) {
             packet.bytes_received = 2;
@@ -337,7 +370,12 @@ public:
             if (packet.header.checksum == packet.header_checksum) {
               // The SYNC control packet is a special case in that it doesn't require the stream sync to be correct
               if (static_cast<Protocol>(packet.header.protocol()) == Protocol::CONTROL && static_cast<ProtocolControl>(packet.header.type()) == ProtocolControl::SYNC) {
-                  SERIAL_ECHOLNPAIR("ss", sync, ",", buffer_size, ",", VERSION_MAJOR, ".", VERSION_MINOR, ".", VERSION_PATCH);
+                  #ifdef BINARY_STREAM_BUFFERS
+                    // Also tell the host how many packets it may send ahead of the 'ok'
+                    SERIAL_ECHOLNPAIR("ss", sync, ",", packet_size, ",", VERSION_MAJOR, ".", VERSION_MINOR, ".", VERSION_PATCH, ",", BINARY_STREAM_BUFFERS);
+                  #else
+                    SERIAL_ECHOLNPAIR("ss", sync, ",", packet_size, ",", VERSION_MAJOR, ".", VERSION_MINOR, ".", VERSION_PATCH);
+                  #endif
                   stream_state = StreamState::PACKET_RESET;
                   break;
               }
@@ -346,7 +384,11 @@ public:
                 packet.bytes_received = 0;
                 if (packet.header.size) {
                   stream_state = StreamState::PACKET_DATA;
-                  packet.buffer = static_cast<char *>(&buffer[0]); // multipacket buffering not implemented, always allocate whole buffer to packet
+                  #ifdef BINARY_STREAM_BUFFERS
+                    packet.buffer = slot[(slot_head + slot_count) % (BINARY_STREAM_BUFFERS)].buffer;
+                  #else
+                    packet.buffer = static_cast<char *>(&buffer[0]); // multipacket buffering not implemented, always allocate whole buffer to packet
+                  #endif
                 }
                 else
                   stream_state = StreamState::PACKET_PROCESS;
@@ -373,7 +415,7 @@ public:
         case StreamState::PACKET_DATA:
           if (!stream_read(data)) break;
 
-          if (buffer_next_index < buffer_size)
+          if (buffer_next_index < packet_size)
             packet.buffer[buffer_next_index] = data;
           else {
             SERIAL_ECHO_MSG("Datastream packet data buffer overrun");
@@ -411,7 +453,13 @@ public:
           bytes_received += packet.header.size;
 
           SERIAL_ECHOLNPAIR("ok", packet.header.sync); // transmit valid packet received
-          dispatch();
+          #ifdef BINARY_STREAM_BUFFERS
+            // Keep the packet and process it when the host pauses or all buffers are used
+            slot[(slot_head + slot_count) % (BINARY_STREAM_BUFFERS)].header = packet.header;
+            if (++slot_count == BINARY_STREAM_BUFFERS) dispatch_buffered();
+          #else
+            dispatch(packet.header, packet.buffer);
+          #endif
           stream_state = StreamState::PACKET_RESET;
           break;
         case StreamState::PACKET_RESEND:
@@ -440,10 +488,10 @@ public:
     #pragma GCC diagnostic pop
   }
 
-  void dispatch() {
-    switch(static_cast<Protocol>(packet.header.protocol())) {
+  void dispatch(Packet::Header &header, char* buffer) {
+    switch(static_cast<Protocol>(header.protocol())) {
       case Protocol::CONTROL:
-        switch(static_cast<ProtocolControl>(packet.header.type())) {
+        switch(static_cast<ProtocolControl>(header.type())) {
           case ProtocolControl::CLOSE: // revert back to ASCII mode
             card.flag.binary_mode = false;
             break;
@@ -452,13 +500,24 @@ public:
         }
         break;
       case Protocol::FILE_TRANSFER:
-        SDFileTransferProtocol::process(packet.header.type(), packet.buffer, packet.header.size); // send user data to be processed
+        SDFileTransferProtocol::process(header.type(), buffer, header.size); // send user data to be processed
       break;
       default:
         SERIAL_ECHO_MSG("Unsupported Binary Protocol");
     }
   }
 
+  #ifdef BINARY_STREAM_BUFFERS
+    // Process the packets that have been acknowledged, in order
+    void dispatch_buffered() {
+      for (; slot_count; slot_count--) {
+        Slot &s = slot[slot_head];
+        dispatch(s.header, s.buffer);
+        slot_head = (slot_head + 1) % (BINARY_STREAM_BUFFERS);
+      }
+    }
+  #endif
+
   void idle() {
     // Some Protocols may need periodic updates without new data
     SDFileTransferProtocol::idle();
@@ -469,6 +528,17 @@ public:
   uint16_t buffer_next_index;
   uint32_t bytes_received;
   StreamState stream_state = StreamState::PACKET_RESET;
+
+  #ifdef BINARY_STREAM_BUFFERS
+    // Packets received and acknowledged but not yet processed.
+    // Only one port transfers at a time so they are shared.
+    struct Slot {
+      Packet::Header header;
+      char buffer[BINARY_STREAM_PACKET_SIZE];
+    };
+    static Slot slot[BINARY_STREAM_BUFFERS];
+    static uint8_t slot_head, slot_count;
+  #endif
 };
 
 extern BinaryStream binaryStream[NUM_SERIAL];
@@ -0,0 +1,136 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/idle_tasks.cpp - Budgeted scheduling of the idle() tasks
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(IDLE_TASK_SCHEDULER)
+
+#include "idle_tasks.h"
+#include "../module/planner.h"
+
+IdleTasks idle_tasks;
+
+idle_task_stats_t IdleTasks::stats[IDLE_TASKS];
+millis_t IdleTasks::next_ms[IDLE_TASKS],
+         IdleTasks::defer_until[IDLE_TASKS];
+uint32_t IdleTasks::recent_us[IDLE_TASKS];
+uint16_t IdleTasks::deferring; // = 0
+
+static_assert(IDLE_TASKS <= 16, "IdleTasks::deferring has too few bits.");
+
+//                                               period ms, budget us, deferrable
+static const idle_task_t task_table[IDLE_TASKS] = {
+  /* IDLE_TASK_INACTIVITY  */ {   0,  100, false },
+  /* IDLE_TASK_HEATERS     */ {   0,  500, false },   // Also feeds the watchdog
+  /* IDLE_TASK_LEDS        */ {   0,  500, true  },
+  /* IDLE_TASK_RUNOUT      */ {   0,  100, false },
+  /* IDLE_TASK_MEDIA       */ { 100, 1000, true  },
+  /* IDLE_TASK_READ_AHEAD  */ {   0, 2000, false },   // Keeps the command queue full
+  /* IDLE_TASK_KEEPALIVE   */ {   0,  200, true  },
+  /* IDLE_TASK_PRINT_TIMER */ { 100,  200, true  },
+  /* IDLE_TASK_BEEPER      */ {   0,   50, false },
+  /* IDLE_TASK_UI          */ {   0, 5000, true  },
+  /* IDLE_TASK_AUTO_REPORT */ {   0, 1000, true  },
+  /* IDLE_TASK_LVGL        */ {   0, 5000, true  }
+};
+
+/**
+ * Return true if the task should run on this pass.
+ *
+ * A deferrable task waits while the planner holds some motion, but less
+ * than twice the task's expected run time (and never less than
+ * IDLE_TASK_MIN_BUFFER_MS). With no motion in the buffer there is nothing
+ * to protect, so it runs, as in the MarlinUI::update() 50% rule.
+ */
+bool IdleTasks::due(const IdleTaskID t) {
+  const idle_task_t &task = task_table[t];
+  const millis_t ms = millis();
+
+  if (task.period_ms && PENDING(ms, next_ms[t])) return false;
+
+  if (task.deferrable) {
+    const uint32_t buffered_us = uint32_t(planner.block_buffer_runtime()) << 10,
+                   needed_us = _MAX(uint32_t(IDLE_TASK_MIN_BUFFER_MS) * 1000UL, 2UL * _MAX(uint32_t(task.budget_us), recent_us[t]));
+    if (buffered_us && buffered_us < needed_us) {
+      if (!TEST(deferring, t)) {
+        SBI(deferring, t);
+        defer_until[t] = ms + (IDLE_TASK_MAX_DEFER_MS);
+      }
+      if (PENDING(ms, defer_until[t])) {
+        stats[t].deferred++;
+        return false;
+      }
+    }
+    CBI(deferring, t);
+  }
+
+  if (task.period_ms) next_ms[t] = ms + task.period_ms;
+  return true;
+}
+
+void IdleTasks::done(const IdleTaskID t, const uint32_t start_us) {
+  const uint32_t took = micros() - start_us;
+  idle_task_stats_t &s = stats[t];
+  s.runs++;
+  s.total_us += took;
+  NOLESS(s.max_us, took);
+  if (took > task_table[t].budget_us) s.over_budget++;
+  // Smooth the run time so a single slow run doesn't hold the task back for long
+  recent_us[t] = recent_us[t] - (recent_us[t] >> 3) + (took >> 3);
+}
+
+void IdleTasks::reset() { ZERO(stats); }
+
+static PGM_P task_name(const uint8_t t) {
+  switch (t) {
+    case IDLE_TASK_INACTIVITY:  return PSTR("inactivity");
+    case IDLE_TASK_HEATERS:     return PSTR("heaters");
+    case IDLE_TASK_LEDS:        return PSTR("leds");
+    case IDLE_TASK_RUNOUT:      return PSTR("runout");
+    case IDLE_TASK_MEDIA:       return PSTR("media");
+    case IDLE_TASK_READ_AHEAD:  return PSTR("read-ahead");
+    case IDLE_TASK_KEEPALIVE:   return PSTR("keepalive");
+    case IDLE_TASK_PRINT_TIMER: return PSTR("print timer");
+    case IDLE_TASK_BEEPER:      return PSTR("beeper");
+    case IDLE_TASK_UI:          return PSTR("ui");
+    case IDLE_TASK_AUTO_REPORT: return PSTR("auto-report");
+    default:                    return PSTR("lvgl");
+  }
+}
+
+void IdleTasks::report() {
+  SERIAL_ECHO_MSG("Idle tasks, times in us");
+  LOOP_L_N(t, IDLE_TASKS) {
+    const idle_task_stats_t &s = stats[t];
+    if (!s.runs && !s.deferred) continue;
+    SERIAL_ECHO_START();
+    serialprintPGM(task_name(t));
+    SERIAL_ECHOPAIR(": ", s.runs, " runs, ", s.deferred, " deferred, ", s.over_budget, " over budget ", task_table[t].budget_us);
+    SERIAL_ECHOLNPAIR(", avg ", s.runs ? uint32_t(s.total_us / s.runs) : 0UL, ", max ", s.max_us);
+  }
+}
+
+#endif // IDLE_TASK_SCHEDULER
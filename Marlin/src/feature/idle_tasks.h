@@ -0,0 +1,85 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/idle_tasks.h - Budgeted scheduling of the idle() tasks
+ *
+ * Each task in idle() has a period, a time budget and a flag for whether it
+ * may wait. While the planner buffer holds less motion than the task could
+ * take to run, deferrable tasks are skipped (for up to IDLE_TASK_MAX_DEFER_MS)
+ * so the time goes to planning moves instead.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+enum IdleTaskID : uint8_t {
+  IDLE_TASK_INACTIVITY,   // manage_inactivity()
+  IDLE_TASK_HEATERS,      // thermalManager.manage_heater()
+  IDLE_TASK_LEDS,         // max7219.idle_tasks()
+  IDLE_TASK_RUNOUT,       // runout.run()
+  IDLE_TASK_MEDIA,        // card.manage_media()
+  IDLE_TASK_READ_AHEAD,   // card.read_ahead()
+  IDLE_TASK_KEEPALIVE,    // gcode.host_keepalive()
+  IDLE_TASK_PRINT_TIMER,  // print_job_timer.tick()
+  IDLE_TASK_BEEPER,       // buzzer.tick()
+  IDLE_TASK_UI,           // ui.update(), DWIN_Update(), DWINTouch_refresh()
+  IDLE_TASK_AUTO_REPORT,  // Auto-report temperatures / SD status
+  IDLE_TASK_LVGL,         // LV_TASK_HANDLER()
+  IDLE_TASKS
+};
+
+typedef struct {
+  uint16_t period_ms,     // Least time between runs, 0 for every pass
+           budget_us;     // Expected longest run
+  bool deferrable;        // May wait while the planner buffer is short
+} idle_task_t;
+
+typedef struct {
+  uint32_t runs,
+           deferred,      // Passes skipped to keep the planner fed
+           over_budget,   // Runs that took longer than the budget
+           max_us;
+  uint64_t total_us;
+} idle_task_stats_t;
+
+class IdleTasks {
+public:
+  static idle_task_stats_t stats[IDLE_TASKS];
+
+  static bool due(const IdleTaskID t);
+  static void done(const IdleTaskID t, const uint32_t start_us);
+
+  static void reset();
+  static void report();
+
+private:
+  static millis_t next_ms[IDLE_TASKS],      // When a periodic task may run again
+                  defer_until[IDLE_TASKS];  // When a deferred task must run anyway
+  static uint32_t recent_us[IDLE_TASKS];    // Smoothed run time
+  static uint16_t deferring;                // Tasks waiting on the planner, one bit each
+};
+
+extern IdleTasks idle_tasks;
+
+// Run an idle() task when the scheduler allows it, and time it
+#define IDLE_TASK(T, F) do{ if (IdleTasks::due(IDLE_TASK_##T)) { const uint32_t _idle_t0 = micros(); F; IdleTasks::done(IDLE_TASK_##T, _idle_t0); } }while(0)
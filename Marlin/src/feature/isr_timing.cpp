@@ -0,0 +1,93 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/isr_timing.cpp - Stepper ISR timing histograms
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(STEPPER_ISR_TIMING)
+
+#include "isr_timing.h"
+#include "../module/stepper.h"
+
+IsrTiming isr_timing;
+
+isr_timing_hist_t IsrTiming::hist[ISR_TIMING_CHANNELS];
+uint32_t IsrTiming::loops[STEPPER_ISR_MAX_LOOPS];
+
+void IsrTiming::reset() {
+  const bool was_enabled = stepper.suspend();
+  ZERO(hist);
+  ZERO(loops);
+  if (was_enabled) stepper.wake_up();
+}
+
+static PGM_P channel_name(const uint8_t c) {
+  switch (c) {
+    case ISR_TIMING_PULSE:    return PSTR("pulse");
+    case ISR_TIMING_BLOCK:    return PSTR("block");
+    case ISR_TIMING_ADVANCE:  return PSTR("advance");
+    case ISR_TIMING_BABYSTEP: return PSTR("babystep");
+    case ISR_TIMING_ISR:      return PSTR("isr");
+    default:                  return PSTR("latency");
+  }
+}
+
+void IsrTiming::report() {
+  // Copy the counters so the report is consistent
+  const bool was_enabled = stepper.suspend();
+  isr_timing_hist_t h[ISR_TIMING_CHANNELS];
+  uint32_t l[STEPPER_ISR_MAX_LOOPS];
+  COPY(h, hist);
+  COPY(l, loops);
+  if (was_enabled) stepper.wake_up();
+
+  SERIAL_ECHO_START();
+  SERIAL_ECHOLNPAIR("Stepper ISR timing, in ticks of ", 1000000000UL / (STEPPER_TIMER_RATE), "ns");
+
+  LOOP_L_N(c, ISR_TIMING_CHANNELS) {
+    if (!h[c].calls) continue;
+    SERIAL_ECHO_START();
+    serialprintPGM(channel_name(c));
+    SERIAL_ECHOPAIR(": ", h[c].calls, " calls, max ", h[c].max);
+    // Print the non-empty buckets by their upper bound
+    LOOP_L_N(b, ISR_TIMING_BUCKETS) {
+      if (!h[c].bucket[b]) continue;
+      if (b < ISR_TIMING_BUCKETS - 1)
+        SERIAL_ECHOPAIR(" <", uint32_t(_BV32(b)));
+      else
+        SERIAL_ECHOPAIR(" >=", uint32_t(_BV32(b - 1)));
+      SERIAL_ECHOPAIR(":", h[c].bucket[b]);
+    }
+    SERIAL_EOL();
+  }
+
+  SERIAL_ECHO_START();
+  SERIAL_ECHOPGM("loops:");
+  LOOP_L_N(i, STEPPER_ISR_MAX_LOOPS)
+    if (l[i]) SERIAL_ECHOPAIR(" ", int(i + 1), ":", l[i]);
+  SERIAL_EOL();
+}
+
+#endif // STEPPER_ISR_TIMING
@@ -0,0 +1,82 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/isr_timing.h - Stepper ISR timing histograms
+ *
+ * Each histogram counts durations in stepper timer ticks, in power-of-2
+ * buckets: bucket 0 holds zero ticks, bucket n holds 2^(n-1) to 2^n - 1
+ * ticks, and the last bucket also holds anything longer.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../module/stepper.h"
+
+#define ISR_TIMING_BUCKETS 16
+
+enum IsrTimingChannel : uint8_t {
+  ISR_TIMING_PULSE,       // pulse_phase_isr()
+  ISR_TIMING_BLOCK,       // block_phase_isr()
+  ISR_TIMING_ADVANCE,     // advance_isr()
+  ISR_TIMING_BABYSTEP,    // babystepping_isr()
+  ISR_TIMING_ISR,         // The whole Stepper::isr() call
+  ISR_TIMING_LATENCY,     // From the scheduled time to ISR entry
+  ISR_TIMING_CHANNELS
+};
+
+typedef struct {
+  uint32_t calls,
+           bucket[ISR_TIMING_BUCKETS];
+  hal_timer_t max;
+} isr_timing_hist_t;
+
+class IsrTiming {
+public:
+  static isr_timing_hist_t hist[ISR_TIMING_CHANNELS];
+  static uint32_t loops[STEPPER_ISR_MAX_LOOPS];  // ISR calls by the number of loops they ran
+
+  static void reset();
+  static void report();
+
+  static inline hal_timer_t now() { return HAL_timer_get_count(STEP_TIMER_NUM); }
+
+  FORCE_INLINE static void record(const IsrTimingChannel ch, const hal_timer_t ticks) {
+    isr_timing_hist_t &h = hist[ch];
+    h.calls++;
+    NOLESS(h.max, ticks);
+    #ifdef __AVR__
+      uint8_t b = 0;
+      for (hal_timer_t t = ticks; t; t >>= 1) b++;
+    #else
+      const uint8_t b = ticks ? 32 - __builtin_clz(uint32_t(ticks)) : 0;
+    #endif
+    h.bucket[_MIN(b, ISR_TIMING_BUCKETS - 1)]++;
+  }
+
+  FORCE_INLINE static void record_loops(const uint8_t n) { loops[n - 1]++; }
+};
+
+extern IsrTiming isr_timing;
+
+// Time a stepper ISR phase
+#define ISR_TIMING_PHASE(P, F) do{ const hal_timer_t _isr_t0 = IsrTiming::now(); F; IsrTiming::record(ISR_TIMING_##P, IsrTiming::now() - _isr_t0); }while(0)
@@ -58,6 +58,10 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   #include "fwretract.h"
 #endif
 
+#ifdef POWER_LOSS_JOURNAL
+  #include "../libs/crc16.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_POWER_LOSS_RECOVERY)
 #include "../core/debug_out.h"
 
@@ -123,18 +127,100 @@ void PrintJobRecovery::check() {
  */
 void PrintJobRecovery::purge() {
   init();
-  card.removeJobRecoveryFile();
+  #ifdef POWER_LOSS_JOURNAL
+    // Keep the journal file, so saves never have to allocate it
+    if (journal_open(false) && journal_seq) journal_erase();
+  #else
+    card.removeJobRecoveryFile();
+  #endif
 }
 
+#ifdef POWER_LOSS_JOURNAL
+
+  /**
+   * The journal is a contiguous file of POWER_LOSS_JOURNAL blocks, written
+   * directly to the card. Each save goes to the next block in turn as:
+   *
+   *   "PLRJ" | sequence | sizeof(info) | CRC-16 | info
+   *
+   * A save that is cut short by a power loss fails its CRC, leaving the
+   * one before it as the newest record.
+   */
+  #define JOURNAL_MAGIC 0x4A524C50UL  // "PLRJ"
+
+  typedef struct {
+    uint32_t magic, seq;
+    uint16_t size, crc;
+  } journal_head_t;
+
+  static_assert(sizeof(journal_head_t) + sizeof(job_recovery_info_t) <= 512, "job_recovery_info_t is too large for POWER_LOSS_JOURNAL.");
+
+  uint32_t PrintJobRecovery::journal_block, // = 0
+           PrintJobRecovery::journal_seq;   // = 0
+
+  alignas(4) static uint8_t journal_buf[512];
+
+  static uint16_t journal_crc(const uint32_t seq, const void * const data) {
+    uint16_t crc = 0;
+    crc16(&crc, &seq, sizeof(seq));
+    crc16(&crc, data, sizeof(job_recovery_info_t));
+    return crc;
+  }
+
+  /**
+   * Find the journal and the newest record in it. With 'create' make
+   * the file, replacing a recovery file of another kind.
+   */
+  bool PrintJobRecovery::journal_open(const bool create) {
+    if (journal_block) return true;
+    bool created;
+    journal_block = card.openJobRecoveryJournal(create, created);
+    if (created)
+      journal_erase();  // Clear what the new clusters held before
+    else if (journal_block)
+      journal_scan();
+    return journal_block != 0;
+  }
+
+  void PrintJobRecovery::journal_scan() {
+    journal_seq = 0;
+    journal_head_t head;
+    LOOP_L_N(i, POWER_LOSS_JOURNAL) {
+      if (!card.getSd2Card().readBlock(journal_block + i, journal_buf)) continue;
+      memcpy(&head, journal_buf, sizeof(head));
+      if (head.magic != JOURNAL_MAGIC || head.size != sizeof(info)) continue;
+      if (journal_seq && int32_t(head.seq - journal_seq) <= 0) continue;
+      if (head.crc == journal_crc(head.seq, journal_buf + sizeof(head))) journal_seq = head.seq;
+    }
+  }
+
+  void PrintJobRecovery::journal_erase() {
+    memset(journal_buf, 0, sizeof(journal_buf));
+    LOOP_L_N(i, POWER_LOSS_JOURNAL)
+      if (!card.getSd2Card().writeBlock(journal_block + i, journal_buf))
+        DEBUG_ECHOLNPGM("Power-loss journal erase failed.");
+    journal_seq = 0;
+  }
+
+#endif // POWER_LOSS_JOURNAL
+
 /**
  * Load the recovery data, if it exists
  */
 void PrintJobRecovery::load() {
-  if (exists()) {
-    open(true);
-    (void)file.read(&info, sizeof(info));
-    close();
-  }
+  #ifdef POWER_LOSS_JOURNAL
+    journal_close();  // Find it again, in case the card has changed
+    if (journal_open(false) && journal_seq) {
+      if (card.getSd2Card().readBlock(journal_block + journal_seq % (POWER_LOSS_JOURNAL), journal_buf))
+        memcpy(&info, journal_buf + sizeof(journal_head_t), sizeof(info));
+    }
+  #else
+    if (exists()) {
+      open(true);
+      (void)file.read(&info, sizeof(info));
+      close();
+    }
+  #endif
   debug(PSTR("Load"));
 }
 
@@ -144,6 +230,9 @@ void PrintJobRecovery::load() {
 void PrintJobRecovery::prepare() {
   card.getAbsFilename(info.sd_filename);  // SD filename
   cmd_sdpos = 0;
+  #ifdef POWER_LOSS_JOURNAL
+    journal_close();  // Check the journal again for this job
+  #endif
 }
 
 /**
@@ -311,11 +400,29 @@ void PrintJobRecovery::write() {
 
   debug(PSTR("Write"));
 
-  open(false);
-  file.seekSet(0);
-  const int16_t ret = file.write(&info, sizeof(info));
-  if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
-  if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+  #ifdef POWER_LOSS_JOURNAL
+
+    if (!journal_open(true)) {
+      DEBUG_ECHOLNPGM("Power-loss journal open failed.");
+      return;
+    }
+
+    if (!++journal_seq) ++journal_seq; // non-zero in sequence
+    const journal_head_t head = { JOURNAL_MAGIC, journal_seq, sizeof(info), journal_crc(journal_seq, &info) };
+    memcpy(journal_buf, &head, sizeof(head));
+    memcpy(journal_buf + sizeof(head), &info, sizeof(info));
+    if (!card.getSd2Card().writeBlock(journal_block + journal_seq % (POWER_LOSS_JOURNAL), journal_buf))
+      DEBUG_ECHOLNPGM("Power-loss journal write failed.");
+
+  #else
+
+    open(false);
+    file.seekSet(0);
+    const int16_t ret = file.write(&info, sizeof(info));
+    if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+    if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+
+  #endif
 }
 
 /**
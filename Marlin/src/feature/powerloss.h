@@ -153,7 +153,12 @@ class PrintJobRecovery {
     static void enable(const bool onoff);
     static void changed();
 
-    static inline bool exists() { return card.jobRecoverFileExists(); }
+    #ifdef POWER_LOSS_JOURNAL
+      // The journal file is kept once created, so check for a record in it
+      static inline bool exists() { return journal_open(false) && journal_seq; }
+    #else
+      static inline bool exists() { return card.jobRecoverFileExists(); }
+    #endif
     static inline void open(const bool read) { card.openJobRecoveryFile(read); }
     static inline void close() { file.close(); }
 
@@ -175,6 +180,10 @@ class PrintJobRecovery {
 
     static inline bool valid() { return info.valid(); }
 
+    #ifdef POWER_LOSS_JOURNAL
+      static inline void journal_close() { journal_block = journal_seq = 0; }
+    #endif
+
     #if ENABLED(DEBUG_POWER_LOSS_RECOVERY)
       static void debug(PGM_P const prefix);
     #else
@@ -184,6 +193,14 @@ class PrintJobRecovery {
   private:
     static void write();
 
+    #ifdef POWER_LOSS_JOURNAL
+      static uint32_t journal_block,  //!< First block of the journal file, 0 if not open
+                      journal_seq;    //!< Sequence number of the newest record, 0 if none
+      static bool journal_open(const bool create);
+      static void journal_scan();
+      static void journal_erase();
+    #endif
+
     #if ENABLED(BACKUP_POWER_SUPPLY)
       static void retract_and_lift(const float &zraise);
     #endif
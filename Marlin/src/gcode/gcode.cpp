@@ -94,6 +94,10 @@ uint8_t GcodeSuite::axis_relative = (
   GcodeSuite::WorkspacePlane GcodeSuite::workspace_plane = PLANE_XY;
 #endif
 
+#ifdef ARC_CHORD_TOLERANCE
+  float GcodeSuite::arc_chord_tolerance = (ARC_CHORD_TOLERANCE) * 0.001f;
+#endif
+
 #if ENABLED(CNC_COORDINATE_SYSTEMS)
   int8_t GcodeSuite::active_coordinate_system = -1; // machine space
   xyz_pos_t GcodeSuite::coordinate_system[MAX_COORDINATE_SYSTEMS];
@@ -781,6 +785,26 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 575: M575(); break;                                  // M575: Set serial baudrate
       #endif
 
+      #if ENABLED(STEPPER_BLOCK_PREP)
+        case 594: M594(); break;                                  // M594: Report block start latency
+      #endif
+
+      #if ENABLED(STEPPER_ISR_TIMING)
+        case 595: M595(); break;                                  // M595: Report stepper ISR timing
+      #endif
+
+      #ifdef ARC_CHORD_TOLERANCE
+        case 596: M596(); break;                                  // M596: Set arc chord tolerance
+      #endif
+
+      #if ENABLED(IDLE_TASK_SCHEDULER)
+        case 597: M597(); break;                                  // M597: Report idle task timing
+      #endif
+
+      #if ENABLED(TFT_SKIP_UNCHANGED_AREAS)
+        case 598: M598(); break;                                  // M598: Report TFT frame timing
+      #endif
+
       #if ENABLED(ADVANCED_PAUSE_FEATURE)
         case 600: M600(); break;                                  // M600: Pause for Filament Change
         case 603: M603(); break;                                  // M603: Configure Filament Change
@@ -954,25 +978,38 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
  * This is called from the main loop()
  */
 void GcodeSuite::process_next_command() {
-  char * const current_command = queue.command_buffer[queue.index_r];
+  const uint8_t index_r = queue.ring.index_r();
+  char * const current_command = queue.command_buffer[index_r];
 
-  PORT_REDIRECT(queue.port[queue.index_r]);
+  PORT_REDIRECT(queue.port[index_r]);
 
   #if ENABLED(POWER_LOSS_RECOVERY)
-    recovery.queue_index_r = queue.index_r;
+    recovery.queue_index_r = index_r;
   #endif
 
   if (DEBUGGING(ECHO)) {
     SERIAL_ECHO_START();
-    SERIAL_ECHOLN(current_command);
+    #if ENABLED(PACKED_GCODE)
+      if (parser.is_packed(current_command)) {
+        SERIAL_ECHOPAIR("(packed) ", current_command[2]);
+        SERIAL_ECHOLN(uint16_t(uint8_t(current_command[3]) | (uint8_t(current_command[4]) << 8)));
+      }
+      else
+    #endif
+        SERIAL_ECHOLN(current_command);
     #if ENABLED(M100_FREE_MEMORY_DUMPER)
-      SERIAL_ECHOPAIR("slot:", queue.index_r);
+      SERIAL_ECHOPAIR("slot:", index_r);
       M100_dump_routine(PSTR("   Command Queue:"), &queue.command_buffer[0][0], &queue.command_buffer[BUFSIZE - 1][MAX_CMD_SIZE - 1]);
     #endif
   }
 
   // Parse the next command in the queue
-  parser.parse(current_command);
+  #if ENABLED(GCODE_PREPARSE)
+    if (queue.preparsed[index_r].command_letter != '?')
+      parser.load(queue.preparsed[index_r]);
+    else
+  #endif
+      parser.parse(current_command);
   process_parsed_command();
 }
 
@@ -231,6 +231,11 @@
  * M524 - Abort the current SD print job started with M24. (Requires SDSUPPORT)
  * M540 - Enable/disable SD card abort on endstop hit: "M540 S<state>". (Requires SD_ABORT_ON_ENDSTOP_HIT)
  * M569 - Enable stealthChop on an axis. (Requires at least one _DRIVER_TYPE to be TMC2130/2160/2208/2209/5130/5160)
+ * M594 - Report the longest block start in the stepper ISR: "M594 [R]". R resets the counters. (Requires STEPPER_BLOCK_PREP)
+ * M595 - Report the stepper ISR timing histograms: "M595 [R]". R resets the histograms. (Requires STEPPER_ISR_TIMING)
+ * M596 - Set the arc chord tolerance: "M596 S<microns>". (Requires ARC_SUPPORT and ARC_CHORD_TOLERANCE)
+ * M597 - Report the idle task run counts and times: "M597 [R]". R resets the counts. (Requires IDLE_TASK_SCHEDULER)
+ * M598 - Report the TFT frame times and the pixels drawn and skipped: "M598 [R]". R resets the counts. (Requires TFT_SKIP_UNCHANGED_AREAS)
  * M600 - Pause for filament change: "M600 X<pos> Y<pos> Z<raise> E<first_retract> L<later_retract>". (Requires ADVANCED_PAUSE_FEATURE)
  * M603 - Configure filament change: "M603 T<tool> U<unload_length> L<load_length>". (Requires ADVANCED_PAUSE_FEATURE)
  * M605 - Set Dual X-Carriage movement mode: "M605 S<mode> [X<x_offset>] [R<temp_offset>]". (Requires DUAL_X_CARRIAGE)
@@ -334,6 +339,10 @@ public:
     static WorkspacePlane workspace_plane;
   #endif
 
+  #ifdef ARC_CHORD_TOLERANCE
+    static float arc_chord_tolerance; // (mm) Max deviation of an arc segment from the true arc
+  #endif
+
   #define MAX_COORDINATE_SYSTEMS 9
   #if ENABLED(CNC_COORDINATE_SYSTEMS)
     static int8_t active_coordinate_system;
@@ -780,6 +789,18 @@ private:
 
   TERN_(BAUD_RATE_GCODE, static void M575());
 
+  TERN_(STEPPER_BLOCK_PREP, static void M594());
+
+  TERN_(STEPPER_ISR_TIMING, static void M595());
+
+  #ifdef ARC_CHORD_TOLERANCE
+    static void M596();
+  #endif
+
+  TERN_(IDLE_TASK_SCHEDULER, static void M597());
+
+  TERN_(TFT_SKIP_UNCHANGED_AREAS, static void M598());
+
   #if ENABLED(ADVANCED_PAUSE_FEATURE)
     static void M600();
     static void M603();
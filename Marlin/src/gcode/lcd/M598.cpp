@@ -0,0 +1,41 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(TFT_SKIP_UNCHANGED_AREAS)
+
+#include "../gcode.h"
+#include "../../lcd/tft/tft.h"
+
+/**
+ * M598: Report the TFT frames drawn, the average and longest time per
+ *       frame, and the pixels drawn and skipped as unchanged
+ *
+ *   R - Reset the counts after the report
+ */
+void GcodeSuite::M598() {
+  tft.queue.report();
+  if (parser.seen('R')) tft.queue.reset_stats();
+}
+
+#endif // TFT_SKIP_UNCHANGED_AREAS
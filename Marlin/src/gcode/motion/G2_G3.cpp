@@ -47,7 +47,15 @@
  * The length of each segment is configured in MM_PER_ARC_SEGMENT (Default 1mm)
  * Arcs should only be made relatively large (over 5mm), as larger arcs with
  * larger segments will tend to be more efficient. Your slicer should have
- * options for G2/G3 arc generation. In future these options may be GCode tunable.
+ * options for G2/G3 arc generation.
+ *
+ * With ARC_CHORD_TOLERANCE the segment count is instead the fewest that keep
+ * every chord within the tolerance (M596) of the true arc, so large arcs need
+ * far fewer planner blocks and tight arcs get as many as they need.
+ *
+ * With NATIVE_ARCS an XY arc is instead handed to the planner as a few arc
+ * blocks that the stepper traces step by step along the circle. Arcs that
+ * can't be done that way (e.g., with leveling active) are still segmented.
  */
 void plan_arc(
   const xyze_pos_t &cart,   // Destination position
@@ -103,20 +111,62 @@ void plan_arc(
 
   const feedRate_t scaled_fr_mm_s = MMS_SCALED(feedrate_mm_s);
 
-  // Start with a nominal segment length
-  float seg_length = (
-    #ifdef ARC_SEGMENTS_PER_R
-      constrain(MM_PER_ARC_SEGMENT * radius, MM_PER_ARC_SEGMENT, ARC_SEGMENTS_PER_R)
-    #elif ARC_SEGMENTS_PER_SEC
-      _MAX(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MM_PER_ARC_SEGMENT)
-    #else
-      MM_PER_ARC_SEGMENT
-    #endif
-  );
-  // Divide total travel by nominal segment length
-  uint16_t segments = FLOOR(mm_of_travel / seg_length);
+  #if ENABLED(NATIVE_ARCS)
+    // Let the stepper trace XY arcs that stay within the soft endstops
+    if (p_axis == X_AXIS
+      #if HAS_SOFTWARE_ENDSTOPS
+        && (!soft_endstops_enabled || (
+             WITHIN(center_P - radius, soft_endstop.min.x, soft_endstop.max.x) && WITHIN(center_P + radius, soft_endstop.min.x, soft_endstop.max.x)
+          && WITHIN(center_Q - radius, soft_endstop.min.y, soft_endstop.max.y) && WITHIN(center_Q + radius, soft_endstop.min.y, soft_endstop.max.y)
+        ))
+      #endif
+    ) {
+      const xy_pos_t center = { center_P, center_Q };
+      xyze_pos_t target = cart;
+      apply_motion_limits(target);
+      if (planner.buffer_arc(target, center, angular_travel, scaled_fr_mm_s, active_extruder)) {
+        current_position = target;
+        return;
+      }
+    }
+  #endif
+
+  uint16_t segments;
+
+  #ifdef ARC_CHORD_TOLERANCE
+    const float tolerance = gcode.arc_chord_tolerance;
+    if (tolerance > 0) {
+      // Each segment may span the angle whose sagitta r * (1 - cos(theta / 2)) equals the tolerance.
+      // Written as 4 * asin(sqrt(tol / 2r)) to keep precision when the tolerance is tiny.
+      if (tolerance < radius) {
+        const float theta_per_segment_max = 4 * asinf(SQRT(tolerance / (2 * radius)));
+        segments = _MIN(CEIL(ABS(angular_travel) / theta_per_segment_max), float(UINT16_MAX));
+      }
+      else
+        segments = 1;                     // The chord of any arc is within tolerance
+
+      #if ARC_SEGMENTS_PER_SEC
+        // Don't ask for more segments per second than the planner can take
+        NOMORE(segments, _MAX(mm_of_travel / scaled_fr_mm_s * (ARC_SEGMENTS_PER_SEC), 1.0f));
+      #endif
+    }
+    else
+  #endif
+  {
+    // Start with a nominal segment length
+    const float seg_length = (
+      #ifdef ARC_SEGMENTS_PER_R
+        constrain(MM_PER_ARC_SEGMENT * radius, MM_PER_ARC_SEGMENT, ARC_SEGMENTS_PER_R)
+      #elif ARC_SEGMENTS_PER_SEC
+        _MAX(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MM_PER_ARC_SEGMENT)
+      #else
+        MM_PER_ARC_SEGMENT
+      #endif
+    );
+    // Divide total travel by nominal segment length
+    segments = FLOOR(mm_of_travel / seg_length);
+  }
   NOLESS(segments, min_segments);         // At least some segments
-  seg_length = mm_of_travel / segments;
 
   /**
    * Vector rotation by transformation matrix: r is the original vector, r_T is the rotated vector,
@@ -160,7 +210,7 @@ void plan_arc(
   raw.e = current_position.e;
 
   #if ENABLED(SCARA_FEEDRATE_SCALING)
-    const float inv_duration = scaled_fr_mm_s / seg_length;
+    const float inv_duration = scaled_fr_mm_s * segments / mm_of_travel; // 1 / segment duration
   #endif
 
   millis_t next_idle_ms = millis() + 200UL;
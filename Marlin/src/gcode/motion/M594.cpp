@@ -0,0 +1,50 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(STEPPER_BLOCK_PREP)
+
+#include "../gcode.h"
+#include "../../module/stepper.h"
+
+/**
+ * M594: Report the longest block start in the stepper ISR and how many
+ *       blocks started from a prepared record
+ *
+ *   R - Reset the counters after the report
+ */
+void GcodeSuite::M594() {
+  const hal_timer_t ticks = stepper.block_start_max;
+  SERIAL_ECHO_START();
+  SERIAL_ECHOPAIR("Block start max: ", ticks, " ticks (", uint32_t(ticks) * 1000UL / (STEPPER_TIMER_TICKS_PER_US));
+  SERIAL_ECHOLNPAIR("ns), prepared blocks: ", stepper.blocks_prepared, " of ", stepper.blocks_started);
+
+  if (parser.seen('R')) {
+    const bool was_enabled = stepper.suspend();
+    stepper.block_start_max = 0;
+    stepper.blocks_started = stepper.blocks_prepared = 0;
+    if (was_enabled) stepper.wake_up();
+  }
+}
+
+#endif // STEPPER_BLOCK_PREP
@@ -0,0 +1,46 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#ifdef ARC_CHORD_TOLERANCE
+
+#include "../gcode.h"
+
+/**
+ * M596: Set the arc chord tolerance
+ *
+ *   S<microns> - Max deviation of each G2/G3 segment from the true arc.
+ *                S0 uses the configured segment length instead.
+ *
+ * With no parameters, report the current tolerance.
+ */
+void GcodeSuite::M596() {
+  if (parser.seenval('S'))
+    arc_chord_tolerance = _MAX(parser.value_float(), 0.0f) * 0.001f;
+  else {
+    SERIAL_ECHO_START();
+    SERIAL_ECHOLNPAIR("Arc chord tolerance: ", uint16_t(LROUND(arc_chord_tolerance * 1000)), "um");
+  }
+}
+
+#endif // ARC_CHORD_TOLERANCE
@@ -70,6 +70,14 @@ int GCodeParser::codenum;
   char *GCodeParser::command_args; // start of parameters
 #endif
 
+#if ENABLED(PACKED_GCODE)
+  bool GCodeParser::packed;
+#endif
+
+#if ENABLED(GCODE_PREPARSE)
+  const float *GCodeParser::values, *GCodeParser::value_pre;
+#endif
+
 // Create a global instance of the GCode parser singleton
 GCodeParser parser;
 
@@ -84,6 +92,8 @@ void GCodeParser::reset() {
   command_letter = '?';                 // No command letter
   codenum = 0;                          // No command code
   TERN_(USE_GCODE_SUBCODES, subcode = 0); // No command sub-code
+  TERN_(PACKED_GCODE, packed = false);  // Not a packed command
+  TERN_(GCODE_PREPARSE, values = nullptr); // No pre-parsed values
   #if ENABLED(FASTER_GCODE_PARSER)
     codebits = 0;                       // No codes yet
     //ZERO(param);                      // No parameters (should be safe to comment out this line)
@@ -116,6 +126,10 @@ void GCodeParser::parse(char *p) {
 
   reset(); // No codes to report
 
+  #if ENABLED(PACKED_GCODE)
+    if (is_packed(p)) return parse_packed(p);
+  #endif
+
   auto uppercase = [](char c) {
     if (TERN0(GCODE_CASE_INSENSITIVE, WITHIN(c, 'a', 'z')))
       c += 'A' - 'a';
@@ -340,10 +354,150 @@ void GCodeParser::parse(char *p) {
   }
 }
 
+#if ENABLED(PACKED_GCODE)
+
+  bool GCodeParser::packed_valid(const char * const p) {
+    const uint16_t size = packed_size(p);
+    if (size < 7 || size > MAX_CMD_SIZE) return false;
+    uint8_t checksum = 0;
+    for (uint8_t i = 2; i < size - 1; i++) checksum ^= p[i];
+    if (checksum != uint8_t(p[size - 1])) return false;
+
+    /**
+     * Refuse the commands that only work as text. Keep in step with KEEP_TEXT
+     * in buildroot/share/scripts/pack_gcode.py.
+     *  - A packed command has no string_arg, so commands that take a string.
+     *  - The emergency parser and the queue's M29 check match ASCII.
+     *  - G53 prefixes the move that follows it on the same line.
+     */
+    const uint16_t code = uint8_t(p[3]) | (uint8_t(p[4]) << 8);
+    if (p[2] == 'G') return code != 53;
+    if (p[2] == 'M') switch (code) {
+      case 0: case 1: case 16: case 23: case 28: case 29: case 30: case 32: case 33:
+      case 108: case 110: case 112: case 117: case 118: case 410: case 810 ... 819: case 928:
+        return false;
+      default: break;
+    }
+    return true;
+  }
+
+  void GCodeParser::parse_packed(char *p) {
+    const uint8_t * const b = (uint8_t*)p;
+    const uint8_t end = packed_size(p) - 1;   // Index of the checksum (packed_valid keeps it in range)
+
+    // Bail if the letter is not G, M, or T
+    switch (b[2]) {
+      case 'G': case 'M': case 'T': break;
+      default: return;
+    }
+
+    packed = true;
+    command_ptr = p;
+    command_letter = b[2];
+    codenum = b[3] | (b[4] << 8);
+    TERN_(USE_GCODE_SUBCODES, subcode = b[5]);
+
+    #if ENABLED(GCODE_MOTION_MODES)
+      if (command_letter == 'G' && (codenum <= GTOP || codenum == 5 || TERN0(G38_PROBE_TARGET, codenum == 38))) {
+        motion_mode_codenum = codenum;
+        TERN_(USE_GCODE_SUBCODES, motion_mode_subcode = subcode);
+      }
+    #endif
+
+    // Set flags and offsets directly from the parameter list
+    for (uint8_t i = 6; i < end;) {
+      const uint8_t pb = b[i++];
+      char *valptr = nullptr;
+      if (TEST(pb, 7)) {
+        if (i + sizeof(float) > end) break;   // Truncated value
+        valptr = p + i;
+        i += sizeof(float);
+      }
+      set('A' + (pb & 0x7F), valptr);
+    }
+  }
+
+#endif // PACKED_GCODE
+
+#if ENABLED(GCODE_PREPARSE)
+
+  void GCodeParser::save(state_t &s) {
+    s.command_ptr = command_ptr;
+    s.string_arg = string_arg;
+    s.codebits = codebits;
+    s.codenum = codenum;
+    COPY(s.param, param);
+    s.command_letter = command_letter;
+    TERN_(USE_GCODE_SUBCODES, s.subcode = subcode);
+    TERN_(PACKED_GCODE, s.packed = packed);
+  }
+
+  void GCodeParser::restore(const state_t &s) {
+    command_ptr = s.command_ptr;
+    string_arg = s.string_arg;
+    codebits = s.codebits;
+    codenum = s.codenum;
+    COPY(param, s.param);
+    command_letter = s.command_letter;
+    TERN_(USE_GCODE_SUBCODES, subcode = s.subcode);
+    TERN_(PACKED_GCODE, packed = s.packed);
+  }
+
+  void GCodeParser::preparse(char * const p, state_t &s) {
+    state_t current;
+    save(current);
+    char * const vptr = value_ptr;
+    const float * const vals = values, * const vpre = value_pre;
+
+    // The motion mode belongs to the command being run, so lines that
+    // would use it are left for parse() at run time (letter '?')
+    #if ENABLED(GCODE_MOTION_MODES)
+      const int16_t mm_codenum = motion_mode_codenum;
+      TERN_(USE_GCODE_SUBCODES, const uint8_t mm_subcode = motion_mode_subcode);
+      cancel_motion_mode();
+    #endif
+
+    parse(p);
+    save(s);
+
+    // Convert the values in parameter order, as seen() looks them up
+    uint8_t n = 0;
+    LOOP_L_N(ind, COUNT(param)) {
+      if (!TEST32(codebits, ind)) continue;
+      if (n >= GCODE_PREPARSE_VALUES) break;
+      if (seen('A' + ind) && has_value()) s.value[n] = value_float();
+      n++;
+    }
+
+    #if ENABLED(GCODE_MOTION_MODES)
+      motion_mode_codenum = mm_codenum;
+      TERN_(USE_GCODE_SUBCODES, motion_mode_subcode = mm_subcode);
+    #endif
+
+    restore(current);
+    value_ptr = vptr;
+    values = vals;
+    value_pre = vpre;
+  }
+
+  void GCodeParser::load(const state_t &s) {
+    restore(s);
+    values = s.value;
+    #if ENABLED(GCODE_MOTION_MODES)
+      if (command_letter == 'G' && (codenum <= GTOP || codenum == 5 || TERN0(G38_PROBE_TARGET, codenum == 38))) {
+        motion_mode_codenum = codenum;
+        TERN_(USE_GCODE_SUBCODES, motion_mode_subcode = subcode);
+      }
+    #endif
+  }
+
+#endif // GCODE_PREPARSE
+
 #if ENABLED(CNC_COORDINATE_SYSTEMS)
 
   // Parse the next parameter as a new command
   bool GCodeParser::chain() {
+    if (TERN0(PACKED_GCODE, packed)) return false; // Packed commands can't be chained
     #if ENABLED(FASTER_GCODE_PARSER)
       char *next_command = command_ptr;
       if (next_command) {
@@ -361,6 +515,14 @@ void GCodeParser::parse(char *p) {
 #endif // CNC_COORDINATE_SYSTEMS
 
 void GCodeParser::unknown_command_warning() {
+  #if ENABLED(PACKED_GCODE)
+    if (packed) {
+      SERIAL_ECHO_START();
+      SERIAL_ECHOPAIR(STR_UNKNOWN_COMMAND, command_letter, "", codenum);
+      SERIAL_CHAR('"', '\n');
+      return;
+    }
+  #endif
   SERIAL_ECHO_MSG(STR_UNKNOWN_COMMAND, command_ptr, "\"");
 }
 
@@ -66,6 +66,16 @@ private:
     static char *command_args;      // Args start here, for slow scan
   #endif
 
+  #if ENABLED(PACKED_GCODE)
+    static bool packed;             // The command was pre-parsed by the host
+  #endif
+
+  #if ENABLED(GCODE_PREPARSE)
+    #define GCODE_PREPARSE_VALUES 8 // Values kept for a queued command. Later parameters are read from the text.
+    static const float *values;     // Values of a pre-parsed command, in parameter order
+    static const float *value_pre;  // Set by seen, the pre-parsed value (if any)
+  #endif
+
 public:
 
   // Global states for GCode-level units features
@@ -143,7 +153,11 @@ public:
       const bool b = TEST32(codebits, ind);
       if (b) {
         char * const ptr = command_ptr + param[ind];
-        value_ptr = param[ind] && valid_float(ptr) ? ptr : nullptr;
+        value_ptr = param[ind] && (TERN0(PACKED_GCODE, packed) || valid_float(ptr)) ? ptr : nullptr;
+        #if ENABLED(GCODE_PREPARSE)
+          const uint8_t n = __builtin_popcountl(codebits & (_BV32(ind) - 1)); // Parameters before this one (unsigned int is 16-bit on AVR)
+          value_pre = value_ptr && values && n < GCODE_PREPARSE_VALUES ? &values[n] : nullptr;
+        #endif
       }
       return b;
     }
@@ -230,6 +244,62 @@ public:
   // This uses 54 bytes of SRAM to speed up seen/value
   static void parse(char * p);
 
+  #if ENABLED(PACKED_GCODE)
+    /**
+     * Packed commands are pre-parsed on the host by pack_gcode.py:
+     *
+     *   0xFE | size | letter | code (2) | subcode | params... | checksum
+     *
+     * 'size' counts the bytes from 'letter' up to the checksum, which is
+     * the XOR of those same bytes. Each parameter is a letter index (0-25)
+     * with bit 7 set if a little-endian float value follows.
+     */
+    #define PACKED_GCODE_MARKER 0xFE
+
+    FORCE_INLINE static bool is_packed(const char * const p) { return uint8_t(p[0]) == PACKED_GCODE_MARKER; }
+    FORCE_INLINE static uint16_t packed_size(const char * const p) { return uint16_t(uint8_t(p[1])) + 3; }
+
+    // Check the size and checksum of a complete packed command, and that it takes no string
+    static bool packed_valid(const char * const p);
+
+    // Populate all fields from a packed command
+    static void parse_packed(char * p);
+  #endif
+
+  #if ENABLED(GCODE_PREPARSE)
+    /**
+     * The complete result of parse(), so a queued command can be
+     * parsed when it's enqueued and only dispatched when it runs.
+     * The parameter values are converted too, so value_float()
+     * needs no strtof() when the command runs.
+     * A command_letter of '?' means the line must be parsed at run
+     * time, as with lines that depend on the current motion mode.
+     */
+    typedef struct {
+      char *command_ptr, *string_arg;
+      uint32_t codebits;
+      int codenum;
+      uint8_t param[26];
+      float value[GCODE_PREPARSE_VALUES];
+      char command_letter;
+      #if ENABLED(USE_GCODE_SUBCODES)
+        uint8_t subcode;
+      #endif
+      #if ENABLED(PACKED_GCODE)
+        bool packed;
+      #endif
+    } state_t;
+
+    static void save(state_t &s);
+    static void restore(const state_t &s);
+
+    // Parse a line into 's', leaving the current command untouched
+    static void preparse(char * const p, state_t &s);
+
+    // Restore a pre-parsed command as if parse() had just run
+    static void load(const state_t &s);
+  #endif
+
   #if ENABLED(CNC_COORDINATE_SYSTEMS)
     // Parse the next parameter as a new command
     static bool chain();
@@ -247,6 +317,12 @@ public:
   // Float removes 'E' to prevent scientific notation interpretation
   static inline float value_float() {
     if (value_ptr) {
+      #if ENABLED(GCODE_PREPARSE)
+        if (value_pre) return *value_pre;
+      #endif
+      #if ENABLED(PACKED_GCODE)
+        if (packed) { float f; memcpy(&f, value_ptr, sizeof(f)); return f; }
+      #endif
       char *e = value_ptr;
       for (;;) {
         const char c = *e;
@@ -265,8 +341,14 @@ public:
   }
 
   // Code value as a long or ulong
-  static inline int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
-  static inline uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  static inline int32_t value_long() {
+    if (TERN0(PACKED_GCODE, packed)) return int32_t(value_float());
+    return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L;
+  }
+  static inline uint32_t value_ulong() {
+    if (TERN0(PACKED_GCODE, packed)) return uint32_t(value_long());
+    return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL;
+  }
 
   // Code value for use as time
   static inline millis_t value_millis() { return value_ulong(); }
@@ -67,12 +67,14 @@ long GCodeQueue::last_N[NUM_SERIAL];
  * the main loop. The gcode.process_next_command method parses the next
  * command and hands off execution to individual handler functions.
  */
-uint8_t GCodeQueue::length = 0,  // Count of commands in the queue
-        GCodeQueue::index_r = 0, // Ring buffer read position
-        GCodeQueue::index_w = 0; // Ring buffer write position
+SPSCRing<BUFSIZE> GCodeQueue::ring;
 
 char GCodeQueue::command_buffer[BUFSIZE][MAX_CMD_SIZE];
 
+#if ENABLED(GCODE_PREPARSE)
+  GCodeParser::state_t GCodeQueue::preparsed[BUFSIZE];
+#endif
+
 /*
  * The port that the command was received on
  */
@@ -109,14 +111,14 @@ GCodeQueue::GCodeQueue() {
  * Check whether there are any commands yet to be executed
  */
 bool GCodeQueue::has_commands_queued() {
-  return queue.length || injected_commands_P || injected_commands[0];
+  return !ring.empty() || injected_commands_P || injected_commands[0];
 }
 
 /**
  * Clear the Marlin command queue
  */
 void GCodeQueue::clear() {
-  index_r = index_w = length = 0;
+  ring.clear();
 }
 
 /**
@@ -127,25 +129,41 @@ void GCodeQueue::_commit_command(bool say_ok
     , int16_t p/*=-1*/
   #endif
 ) {
+  const uint8_t index_w = ring.index_w();
   send_ok[index_w] = say_ok;
   TERN_(HAS_MULTI_SERIAL, port[index_w] = p);
   TERN_(POWER_LOSS_RECOVERY, recovery.commit_sdpos(index_w));
-  if (++index_w >= BUFSIZE) index_w = 0;
-  length++;
+  #if ENABLED(GCODE_PREPARSE)
+    // Parse now so execution only has to dispatch. Text bound for SD is left as-is.
+    if (TERN0(SDSUPPORT, card.flag.saving))
+      preparsed[index_w].command_letter = '?';
+    else
+      parser.preparse(command_buffer[index_w], preparsed[index_w]);
+  #endif
+  ring.commit(); // Publish the slot with everything written above
 }
 
 /**
  * Copy a command from RAM into the main command buffer.
  * Return true if the command was successfully added.
  * Return false for a full buffer, or if the 'command' is a comment.
+ * Only the main loop may add commands. See GCodeQueue::ring.
  */
 bool GCodeQueue::_enqueue(const char* cmd, bool say_ok/*=false*/
   #if HAS_MULTI_SERIAL
     , int16_t pn/*=-1*/
   #endif
 ) {
-  if (*cmd == ';' || length >= BUFSIZE) return false;
-  strcpy(command_buffer[index_w], cmd);
+  if (*cmd == ';' || ring.full()) return false;
+  #if ENABLED(PACKED_GCODE)
+    if (parser.is_packed(cmd)) {
+      const uint16_t size = parser.packed_size(cmd);
+      if (size > MAX_CMD_SIZE) return false;
+      memcpy(command_buffer[ring.index_w()], cmd, size);
+    }
+    else
+  #endif
+      strcpy(command_buffer[ring.index_w()], cmd);
   _commit_command(say_ok
     #if HAS_MULTI_SERIAL
       , pn
@@ -283,6 +301,7 @@ void GCodeQueue::ok_to_send() {
     if (pn < 0) return;
     PORT_REDIRECT(pn);                    // Reply to the serial port that sent the command
   #endif
+  const uint8_t index_r = ring.index_r();
   if (!send_ok[index_r]) return;
   SERIAL_ECHOPGM(STR_OK);
   #if ENABLED(ADVANCED_OK)
@@ -294,7 +313,7 @@ void GCodeQueue::ok_to_send() {
         SERIAL_ECHO(*p++);
     }
     SERIAL_ECHOPAIR_P(SP_P_STR, int(planner.moves_free()),
-                      SP_B_STR, int(BUFSIZE - length));
+                      SP_B_STR, int(ring.free()));
   #endif
   SERIAL_EOL();
 }
@@ -349,6 +368,7 @@ FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", b
 #define PS_QUOTED 2
 #define PS_PAREN  3
 #define PS_ESC    4
+#define PS_PACKED 8
 
 inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
 
@@ -402,6 +422,38 @@ inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD
   }
 }
 
+#if ENABLED(PACKED_GCODE)
+
+  enum PackedState : uint8_t { PACKED_NONE, PACKED_MORE, PACKED_DONE, PACKED_BAD };
+
+  /**
+   * A marker at the start of a line begins a packed command, which
+   * is read whole by size, ignoring line endings and comment chars.
+   */
+  inline PackedState process_packed_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+    if (sis != PS_PACKED) {
+      if (sis != PS_NORMAL || ind || !parser.is_packed(&c)) return PACKED_NONE;
+      sis = PS_PACKED;
+    }
+
+    buff[ind++] = c;
+    if (ind < 2) return PACKED_MORE;
+
+    const uint16_t size = parser.packed_size(buff);
+    if (ind == 2 && size > MAX_CMD_SIZE) {      // Too big for the buffer
+      sis = PS_NORMAL;
+      ind = 0;
+      return PACKED_BAD;
+    }
+    if (ind < size) return PACKED_MORE;
+
+    sis = PS_NORMAL;
+    ind = 0;
+    return parser.packed_valid(buff) ? PACKED_DONE : PACKED_BAD;
+  }
+
+#endif // PACKED_GCODE
+
 /**
  * Handle a line being completed. For an empty line
  * keep sensor readings going and watchdog alive.
@@ -430,6 +482,7 @@ void GCodeQueue::get_serial_commands() {
        * For binary stream file transfer, use serial_line_buffer as the working
        * receive buffer (which limits the packet size to MAX_CMD_SIZE).
        * The receive buffer also limits the packet size for reliable transmission.
+       * With BINARY_STREAM_BUFFERS the stream has its own packet buffers.
        */
       binaryStream[card.transfer_port_index].receive(serial_line_buffer[card.transfer_port_index]);
       return;
@@ -441,7 +494,7 @@ void GCodeQueue::get_serial_commands() {
   #if NO_TIMEOUTS > 0
     static millis_t last_command_time = 0;
     const millis_t ms = millis();
-    if (length == 0 && !serial_data_available() && ELAPSED(ms, last_command_time + NO_TIMEOUTS)) {
+    if (ring.empty() && !serial_data_available() && ELAPSED(ms, last_command_time + NO_TIMEOUTS)) {
       SERIAL_ECHOLNPGM(STR_WAIT);
       last_command_time = ms;
     }
@@ -450,7 +503,7 @@ void GCodeQueue::get_serial_commands() {
   /**
    * Loop while serial characters are incoming and the queue is not full
    */
-  while (length < BUFSIZE && serial_data_available()) {
+  while (!ring.full() && serial_data_available()) {
     LOOP_L_N(i, NUM_SERIAL) {
 
       const int c = read_serial(i);
@@ -458,6 +511,26 @@ void GCodeQueue::get_serial_commands() {
 
       const char serial_char = c;
 
+      #if ENABLED(PACKED_GCODE)
+        const PackedState packed = process_packed_char(serial_char, serial_input_state[i], serial_line_buffer[i], serial_count[i]);
+        // A bad packed command is handled like a checksum error, with a resend request
+        if (packed == PACKED_BAD || (packed == PACKED_DONE && TERN0(SDSUPPORT, card.flag.saving)))
+          return gcode_line_error(PSTR(STR_ERR_PACKED_LINE), i);
+
+        if (packed == PACKED_DONE) {
+          #if defined(NO_TIMEOUTS) && NO_TIMEOUTS > 0
+            last_command_time = ms;
+          #endif
+          last_N[i]++;                         // Packed commands take the next line number
+          _enqueue(serial_line_buffer[i], true
+            #if HAS_MULTI_SERIAL
+              , i
+            #endif
+          );
+        }
+        if (packed != PACKED_NONE) continue;
+      #endif
+
       if (ISEOL(serial_char)) {
 
         // Reset our state, continue if the line was empty
@@ -567,21 +640,36 @@ void GCodeQueue::get_serial_commands() {
 
     int sd_count = 0;
     bool card_eof = card.eof();
-    while (length < BUFSIZE && !card_eof) {
-      const int16_t n = card.get();
-      card_eof = card.eof();
-      if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
 
-      const char sd_char = (char)n;
+    // Handle the character at file position 'pos', or the end of the file
+    auto process_sd_char = [&](const char sd_char, const uint32_t pos) {
+      UNUSED(pos);
+
+      #if ENABLED(PACKED_GCODE)
+        const PackedState packed = process_packed_char(sd_char, sd_input_state, command_buffer[ring.index_w()], sd_count);
+        if (packed == PACKED_DONE) {
+          _commit_command(false);
+          #if ENABLED(POWER_LOSS_RECOVERY)
+            recovery.cmd_sdpos = pos;                 // Prime for the NEXT _commit_command
+          #endif
+        }
+        else if (packed == PACKED_BAD)
+          SERIAL_ERROR_MSG(STR_ERR_PACKED_GCODE);
+        if (packed != PACKED_NONE) {
+          if (!card_eof) return;
+          sd_count = 0;                               // Drop a command cut off by the end of file
+        }
+      #endif
+
       const bool is_eol = ISEOL(sd_char);
       if (is_eol || card_eof) {
 
         // Reset stream state, terminate the buffer, and commit a non-empty command
         if (!is_eol && sd_count) ++sd_count;          // End of file with no newline
-        if (!process_line_done(sd_input_state, command_buffer[index_w], sd_count)) {
+        if (!process_line_done(sd_input_state, command_buffer[ring.index_w()], sd_count)) {
           _commit_command(false);
           #if ENABLED(POWER_LOSS_RECOVERY)
-            recovery.cmd_sdpos = card.getIndex();     // Prime for the NEXT _commit_command
+            recovery.cmd_sdpos = pos;                 // Prime for the NEXT _commit_command
           #endif
         }
 
@@ -592,8 +680,30 @@ void GCodeQueue::get_serial_commands() {
         
       }
       else
-        process_stream_char(sd_char, sd_input_state, command_buffer[index_w], sd_count);
-
+        process_stream_char(sd_char, sd_input_state, command_buffer[ring.index_w()], sd_count);
+    };
+
+    while (!ring.full() && !card_eof) {
+      #ifdef SD_READ_AHEAD
+        // Take the rest of the line in one piece, straight from the read-ahead
+        const char *line;
+        const int16_t len = card.get_line(line);
+        card_eof = card.eof();
+        if (len < 0) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
+        if (card_eof) { process_sd_char(char(-1), card.getIndex()); continue; }
+
+        const uint32_t start = card.getIndex() + 1 - len;
+        for (int16_t i = 0; i < len; i++) {
+          process_sd_char(line[i], start + i);
+          // Packed commands don't end a line, so the queue may fill mid-line
+          if (ring.full() && i + 1 < len) { card.unget(len - 1 - i); break; }
+        }
+      #else
+        const int16_t n = card.get();
+        card_eof = card.eof();
+        if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
+        process_sd_char((char)n, card.getIndex());
+      #endif
     }
   }
 
@@ -621,12 +731,12 @@ void GCodeQueue::advance() {
   if (process_injected_command_P() || process_injected_command()) return;
 
   // Return if the G-code buffer is empty
-  if (!length) return;
+  if (ring.empty()) return;
 
   #if ENABLED(SDSUPPORT)
 
     if (card.flag.saving) {
-      char* command = command_buffer[index_r];
+      char* command = command_buffer[ring.index_r()];
       if (is_M29(command)) {
         // M29 closes the file
         card.closefile();
@@ -662,7 +772,6 @@ void GCodeQueue::advance() {
   #endif // SDSUPPORT
 
   // The queue may be reset by a command handler or by code invoked by idle() within a handler
-  --length;
-  if (++index_r >= BUFSIZE) index_r = 0;
+  if (!ring.empty()) ring.release();
 
 }
@@ -27,6 +27,11 @@
  */
 
 #include "../inc/MarlinConfig.h"
+#include "../core/spsc.h"
+
+#if ENABLED(GCODE_PREPARSE)
+  #include "parser.h"
+#endif
 
 class GCodeQueue {
 public:
@@ -46,12 +51,26 @@ public:
    * (immediate, serial, sd card) and they are processed sequentially by
    * the main loop. The gcode.process_next_command method parses the next
    * command and hands off execution to individual handler functions.
+   *
+   * The ring positions are SPSC with acquire / release ordering, so a
+   * committed command is always seen whole. A slot and its send_ok / port
+   * entries belong to the producer until it is committed, and to the
+   * consumer until it is released. There is only one producer because
+   * serial, SD, and the handlers that call enqueue_one_now() all run on
+   * the main loop. Filling the ring from another thread or core needs a
+   * lock around _enqueue().
    */
-  static uint8_t length,  // Count of commands in the queue
-                 index_r; // Ring buffer read position
+  static SPSCRing<BUFSIZE> ring;
 
   static char command_buffer[BUFSIZE][MAX_CMD_SIZE];
 
+  #if ENABLED(GCODE_PREPARSE)
+    /**
+     * Each command parsed as it was committed
+     */
+    static GCodeParser::state_t preparsed[BUFSIZE];
+  #endif
+
   /**
    * The port that the command was received on
    */
@@ -60,13 +79,13 @@ public:
   #endif
 
   static int16_t command_port() {
-    return TERN0(HAS_MULTI_SERIAL, port[index_r]);
+    return TERN0(HAS_MULTI_SERIAL, port[ring.index_r()]);
   }
 
   GCodeQueue();
 
   /**
-   * Clear the Marlin command queue
+   * Clear the Marlin command queue (consumer side)
    */
   static void clear();
 
@@ -149,8 +168,6 @@ public:
 
 private:
 
-  static uint8_t index_w;  // Ring buffer write position
-
   static void get_serial_commands();
 
   #if ENABLED(SDSUPPORT)
@@ -422,3 +422,8 @@
 #if ANY(AUTO_BED_LEVELING_UBL, AUTO_BED_LEVELING_LINEAR, Z_STEPPER_ALIGN_KNOWN_STEPPER_POSITIONS)
   #define NEED_LSF 1
 #endif
+
+// Count planner work for the motion benchmark report
+#if ENABLED(MOTION_BENCHMARK)
+  #define PLANNER_RECALC_STATS 1
+#endif
@@ -2604,6 +2604,11 @@
   #define HAS_FOLDER_SORTING 1
 #endif
 
+// The planner tracks the time its blocks will take
+#if HAS_SPI_LCD || ENABLED(IDLE_TASK_SCHEDULER)
+  #define HAS_BLOCK_BUFFER_RUNTIME 1
+#endif
+
 #if HAS_SPI_LCD
   // Get LCD character width/height, which may be overridden by pins, configs, etc.
   #ifndef LCD_WIDTH
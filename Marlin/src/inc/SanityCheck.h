@@ -716,6 +716,13 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "LIGHTWEIGHT_UI requires a U8GLIB_ST7920-based display."
 #endif
 
+/**
+ * Skip Unchanged Display Pages. Only the u8g devices in lcd/dogm support it.
+ */
+#if ENABLED(DOGM_SKIP_UNCHANGED_PAGES) && (ENABLED(REPRAPWORLD_GRAPHICAL_LCD) || NONE(U8GLIB_ST7920, U8GLIB_ST7565_64128N, FYSETC_MINI_12864, MKS_MINI_12864, ENDER2_STOCKDISPLAY, TFT_SCALED_DOGLCD))
+  #error "DOGM_SKIP_UNCHANGED_PAGES requires a U8GLIB_ST7920, U8GLIB_ST7565_64128N, or UC1701 Mini 12864 display, or TFT_SCALED_DOGLCD."
+#endif
+
 /**
  * SD File Sorting
  */
@@ -1667,6 +1674,10 @@ static_assert(hbm[Z_AXIS] >= 0, "HOMING_BUMP_MM.Z must be greater than or equal
   #error "TEMP_SENSOR_CHAMBER 1000 requires CHAMBER_PULLUP_RESISTOR_OHMS, CHAMBER_RESISTANCE_25C_OHMS and CHAMBER_BETA in Configuration_adv.h."
 #endif
 
+#if defined(USER_THERMISTOR_TABLE) && !WITHIN(USER_THERMISTOR_TABLE, 2, 255)
+  #error "USER_THERMISTOR_TABLE must be from 2 to 255."
+#endif
+
 /**
  * A Sensor ID has to be set for each heater
  */
@@ -2179,6 +2190,51 @@ static_assert(hbm[Z_AXIS] >= 0, "HOMING_BUMP_MM.Z must be greater than or equal
     + ENABLED(IIC_BL24CXX_EEPROM)
     #error "Please select only one method of EEPROM Persistent Storage."
   #endif
+  #if ENABLED(EEPROM_TAGGED_SETTINGS) && DISABLED(EEPROM_STAGED_WRITE)
+    #error "EEPROM_TAGGED_SETTINGS requires EEPROM_STAGED_WRITE."
+  #endif
+#endif
+
+/**
+ * Binary file transfer buffers
+ */
+#ifdef BINARY_STREAM_BUFFERS
+  #if DISABLED(BINARY_FILE_TRANSFER)
+    #error "BINARY_STREAM_BUFFERS requires BINARY_FILE_TRANSFER."
+  #elif !WITHIN(BINARY_STREAM_BUFFERS, 2, 8)
+    #error "BINARY_STREAM_BUFFERS must be from 2 to 8."
+  #elif !WITHIN(BINARY_STREAM_PACKET_SIZE, 64, 1024)
+    #error "BINARY_STREAM_PACKET_SIZE must be from 64 to 1024 bytes."
+  #elif !HAS_USB_SERIAL && !(defined(__AVR__) && defined(USBCON)) && RX_BUFFER_SIZE < (BINARY_STREAM_BUFFERS) * (BINARY_STREAM_PACKET_SIZE)
+    #error "BINARY_STREAM_BUFFERS without a USB port requires RX_BUFFER_SIZE >= BINARY_STREAM_BUFFERS * BINARY_STREAM_PACKET_SIZE."
+  #endif
+#endif
+
+/**
+ * SD read-ahead
+ */
+#ifdef SD_READ_AHEAD
+  #if DISABLED(SDSUPPORT)
+    #error "SD_READ_AHEAD requires SDSUPPORT."
+  #elif !WITHIN(SD_READ_AHEAD, 2, 16)
+    #error "SD_READ_AHEAD must be from 2 to 16 blocks."
+  #endif
+#endif
+
+#ifdef SD_EXTENT_CACHE
+  #if DISABLED(SDSUPPORT)
+    #error "SD_EXTENT_CACHE requires SDSUPPORT."
+  #elif !WITHIN(SD_EXTENT_CACHE, 1, 64)
+    #error "SD_EXTENT_CACHE must be from 1 to 64."
+  #endif
+#endif
+
+#ifdef POWER_LOSS_JOURNAL
+  #if DISABLED(POWER_LOSS_RECOVERY)
+    #error "POWER_LOSS_JOURNAL requires POWER_LOSS_RECOVERY."
+  #elif !WITHIN(POWER_LOSS_JOURNAL, 2, 128)
+    #error "POWER_LOSS_JOURNAL must be from 2 to 128 sectors."
+  #endif
 #endif
 
 /**
@@ -2276,6 +2332,19 @@ static_assert(hbm[Z_AXIS] >= 0, "HOMING_BUMP_MM.Z must be greater than or equal
 #undef IS_EXTUI
 #undef IS_ULTIPANEL
 
+/**
+ * CR-6 touch screen write queue
+ */
+#ifdef DWIN_TOUCHLCD_VP_QUEUE
+  #if DISABLED(DWIN_CREALITY_TOUCHLCD)
+    #error "DWIN_TOUCHLCD_VP_QUEUE requires DWIN_CREALITY_TOUCHLCD."
+  #elif !WITHIN(DWIN_TOUCHLCD_VP_QUEUE, 8, 255)
+    #error "DWIN_TOUCHLCD_VP_QUEUE must be from 8 to 255 words."
+  #elif !WITHIN(DWIN_TOUCHLCD_TX_BUFFER_SIZE, 128, 1024)
+    #error "DWIN_TOUCHLCD_TX_BUFFER_SIZE must be from 128 to 1024 bytes."
+  #endif
+#endif
+
 #if 1 < ENABLED(LCD_SCREEN_ROT_0) + ENABLED(LCD_SCREEN_ROT_90) + ENABLED(LCD_SCREEN_ROT_180) + ENABLED(LCD_SCREEN_ROT_270)
   #error "Please enable only one LCD_SCREEN_ROT_* option: 0, 90, 180, or 270."
 #endif
@@ -2749,6 +2818,18 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #error "GCODE_MACROS_SLOTS must be a number from 1 to 10."
 #endif
 
+#if ENABLED(PACKED_GCODE)
+  #if DISABLED(FASTER_GCODE_PARSER)
+    #error "PACKED_GCODE requires FASTER_GCODE_PARSER."
+  #elif MAX_CMD_SIZE > 255
+    #error "PACKED_GCODE requires a MAX_CMD_SIZE of 255 or less."
+  #endif
+#endif
+
+#if ENABLED(GCODE_PREPARSE) && DISABLED(FASTER_GCODE_PARSER)
+  #error "GCODE_PREPARSE requires FASTER_GCODE_PARSER."
+#endif
+
 #if ENABLED(CUSTOM_USER_MENUS)
   #ifdef USER_GCODE_1
     constexpr char _chr1 = USER_GCODE_1[strlen(USER_GCODE_1) - 1];
@@ -3118,5 +3199,67 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #endif
 #endif
 
+/**
+ * Fixed-point planner
+ */
+#if BOTH(PLANNER_FIXED_POINT, LASER_POWER_INLINE_TRAPEZOID)
+  #error "PLANNER_FIXED_POINT is not compatible with LASER_POWER_INLINE_TRAPEZOID."
+#endif
+
+/**
+ * Packed Bresenham
+ */
+#if ENABLED(BRESENHAM_SWAR)
+  #ifdef __AVR__
+    #error "BRESENHAM_SWAR requires a 32-bit board."
+  #elif ENABLED(MIXING_EXTRUDER)
+    #error "BRESENHAM_SWAR is not compatible with MIXING_EXTRUDER."
+  #endif
+#endif
+
+/**
+ * Arc chord tolerance
+ */
+#if defined(ARC_CHORD_TOLERANCE) && DISABLED(ARC_SUPPORT)
+  #error "ARC_CHORD_TOLERANCE requires ARC_SUPPORT."
+#endif
+
+/**
+ * Native arcs
+ */
+#if ENABLED(NATIVE_ARCS)
+  #if DISABLED(ARC_SUPPORT)
+    #error "NATIVE_ARCS requires ARC_SUPPORT."
+  #elif defined(__AVR__)
+    #error "NATIVE_ARCS requires a 32-bit board."
+  #elif IS_KINEMATIC || IS_CORE || ENABLED(MARKFORGED_XY)
+    #error "NATIVE_ARCS requires a Cartesian machine."
+  #elif ENABLED(BACKLASH_COMPENSATION)
+    #error "NATIVE_ARCS is not compatible with BACKLASH_COMPENSATION."
+  #elif ENABLED(SKEW_CORRECTION)
+    #error "NATIVE_ARCS is not compatible with SKEW_CORRECTION."
+  #endif
+#endif
+
+/**
+ * Stepper block preparation
+ */
+#if ENABLED(STEPPER_BLOCK_PREP)
+  #ifdef __AVR__
+    #error "STEPPER_BLOCK_PREP requires a 32-bit board."
+  #elif !defined(STEPPER_BLOCK_PREP_AHEAD) || STEPPER_BLOCK_PREP_AHEAD < 2 || !IS_POWER_OF_2(STEPPER_BLOCK_PREP_AHEAD)
+    #error "STEPPER_BLOCK_PREP_AHEAD must be a power of 2 of at least 2."
+  #elif STEPPER_BLOCK_PREP_AHEAD > BLOCK_BUFFER_SIZE
+    #error "STEPPER_BLOCK_PREP_AHEAD must not exceed BLOCK_BUFFER_SIZE."
+  #endif
+#endif
+
+/**
+ * Sanity Check for the motion benchmark
+ */
+#if ENABLED(MOTION_BENCHMARK) && !defined(__PLAT_LINUX__)
+  #error "MOTION_BENCHMARK requires the LINUX HAL (env:linux_native_benchmark)."
+#endif
+
 // Misc. Cleanup
 #undef _TEST_PWM
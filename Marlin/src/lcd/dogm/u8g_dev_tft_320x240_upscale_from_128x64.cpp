@@ -60,6 +60,7 @@
 
 #include "HAL_LCD_com_defines.h"
 #include "ultralcd_DOGM.h"
+#include "u8g_page_cache.h"
 
 #include <string.h>
 
@@ -628,6 +629,7 @@ inline void memset2(const void *ptr, uint16_t fill, size_t cnt) {
 
 static bool preinit = true;
 static uint8_t page;
+TERN_(DOGM_SKIP_UNCHANGED_PAGES, static bool page_skipped);
 
 uint8_t u8g_dev_tft_320x240_upscale_from_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
   u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
@@ -641,6 +643,7 @@ uint8_t u8g_dev_tft_320x240_upscale_from_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, u
 
   switch (msg) {
     case U8G_DEV_MSG_INIT:
+      TERN_(DOGM_SKIP_UNCHANGED_PAGES, u8g_page_cache_clear());
       dev->com_fn(u8g, U8G_COM_MSG_INIT, U8G_SPI_CLK_CYCLE_NONE, &lcd_id);
       tftio.DataTransferBegin(DATASIZE_8BIT);
       switch (lcd_id & 0xFFFF) {
@@ -715,12 +718,22 @@ uint8_t u8g_dev_tft_320x240_upscale_from_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, u
 
     case U8G_DEV_MSG_PAGE_FIRST:
       page = 0;
+      TERN_(DOGM_SKIP_UNCHANGED_PAGES, page_skipped = false);
       setWindow(u8g, dev, TFT_PIXEL_OFFSET_X, TFT_PIXEL_OFFSET_Y, X_HI, Y_HI);
       break;
 
     case U8G_DEV_MSG_PAGE_NEXT:
       if (++page > (HEIGHT / PAGE_HEIGHT)) return 1;
 
+      #if ENABLED(DOGM_SKIP_UNCHANGED_PAGES)
+        // After skipping a page the window must start at this one
+        if (U8G_PAGE_UNCHANGED(pb)) { page_skipped = true; break; }
+        if (page_skipped) {
+          page_skipped = false;
+          setWindow(u8g, dev, TFT_PIXEL_OFFSET_X, UPSCALE(TFT_PIXEL_OFFSET_Y, pb->p.page_y0), X_HI, Y_HI);
+        }
+      #endif
+
       LOOP_L_N(y, PAGE_HEIGHT) {
         uint32_t k = 0;
         #if HAS_LCD_IO
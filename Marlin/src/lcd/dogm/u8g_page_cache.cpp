@@ -0,0 +1,70 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * lcd/dogm/u8g_page_cache.cpp - Skip sending u8g pages that haven't changed
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if HAS_GRAPHICAL_LCD && ENABLED(DOGM_SKIP_UNCHANGED_PAGES)
+
+#include "u8g_page_cache.h"
+
+// One checksum per 8 rows, the smallest page height of the devices
+static uint32_t page_sum[(LCD_PIXEL_HEIGHT) / 8];
+static millis_t next_full_refresh_ms;
+
+void u8g_page_cache_clear() { ZERO(page_sum); }
+
+/**
+ * Return true if the page must be sent, and remember its checksum.
+ * Every DOGM_FULL_REFRESH_INTERVAL seconds all pages are sent, to repair
+ * any corruption of the display RAM.
+ */
+bool u8g_page_changed(const u8g_pb_t * const pb) {
+  const uint8_t y0 = pb->p.page_y0, index = y0 / 8;
+  if (index >= COUNT(page_sum)) return true;
+
+  if (y0 == 0) {
+    const millis_t ms = millis();
+    if (ELAPSED(ms, next_full_refresh_ms)) {
+      next_full_refresh_ms = ms + SEC_TO_MS(DOGM_FULL_REFRESH_INTERVAL);
+      u8g_page_cache_clear();
+    }
+  }
+
+  // Fletcher-style sums, cheap on 8-bit MCUs and sensitive to byte order
+  const uint8_t *buf = (const uint8_t *)pb->buf;
+  uint16_t a = 1, b = 0;
+  for (uint16_t n = uint16_t(pb->p.page_height / 8) * pb->width; n--;) {
+    a += *buf++;
+    b += a;
+  }
+  const uint32_t sum = (uint32_t(b) << 16) | a;   // A blank page doesn't match a cleared entry
+
+  if (page_sum[index] == sum) return false;
+  page_sum[index] = sum;
+  return true;
+}
+
+#endif // HAS_GRAPHICAL_LCD && DOGM_SKIP_UNCHANGED_PAGES
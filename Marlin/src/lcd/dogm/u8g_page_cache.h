@@ -0,0 +1,41 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * lcd/dogm/u8g_page_cache.h - Skip sending u8g pages that haven't changed
+ *
+ * The devices in lcd/dogm keep a checksum of each page they last sent.
+ * A page whose buffer is the same as last time is not sent to the display.
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#include <U8glib.h>
+
+#if ENABLED(DOGM_SKIP_UNCHANGED_PAGES)
+  bool u8g_page_changed(const u8g_pb_t * const pb);
+  void u8g_page_cache_clear();
+  #define U8G_PAGE_UNCHANGED(PB) !u8g_page_changed(PB)
+#else
+  #define U8G_PAGE_UNCHANGED(PB) false
+#endif
@@ -263,6 +263,10 @@ void RTSSHOW::RTS_SDCardUpate(void)
 
 void RTSSHOW::RTS_Init()
 {
+  #ifdef DWIN_TOUCHLCD_VP_QUEUE
+    ZERO(vp_shadow);
+  #endif
+
   AxisUnitMode = 1;
   last_zoffset = probe.offset.z;
   RTS_SndData(probe.offset.z * 100, AUTO_BED_LEVEL_ZOFFSET_VP);
@@ -330,6 +334,7 @@ void RTSSHOW::RTS_Init()
   for(startprogress = 0; startprogress <= 100; startprogress++)
   {
     rtscheck.RTS_SndData(startprogress, START_PROCESS_ICON_VP);
+    rtscheck.RTS_Flush(true);
     delay(30);
   }
 
@@ -421,6 +426,10 @@ int RTSSHOW::RTS_RecData()
         recdat.data[i/2]= databuf[7+i];
         recdat.data[i/2]= (recdat.data[i/2] << 8 )| databuf[8+i];
       }
+      #ifdef DWIN_TOUCHLCD_VP_QUEUE
+        // The screen reports variables the user has changed
+        vp_invalidate(recdat.addr, recdat.bytelen);
+      #endif
     }
     else if(recdat.command == 0x81)
     {
@@ -446,8 +455,153 @@ int RTSSHOW::RTS_RecData()
   return 2;
 }
 
+#ifdef DWIN_TOUCHLCD_VP_QUEUE
+
+/**
+ * Variable writes are queued and sent from RTSUpdate(), each run of adjacent
+ * addresses as one frame. A value the screen already shows is not sent again.
+ * Frames go to a buffer that is handed to the USART as it has room, so its
+ * TX interrupt does the sending. Writes that don't fit in the buffer stay
+ * queued for the next update. Only RTS_Flush(true) waits for the USART.
+ */
+void RTSSHOW::vp_write(const uint16_t addr, const uint16_t value)
+{
+  uint8_t i = 0;
+  while (i < vp_count && vp_pending[i].addr < addr) i++;
+  if (i < vp_count && vp_pending[i].addr == addr) {
+    vp_pending[i].value = value;
+    return;
+  }
+
+  const vp_word_t &shadow = vp_shadow[addr % VP_SHADOW_SIZE];
+  if (shadow.addr == addr && shadow.value == value) return;
+
+  if (vp_count == DWIN_TOUCHLCD_VP_QUEUE) {
+    // More changes than the queue holds in one update: send them now
+    vp_commit();
+    if (vp_count == DWIN_TOUCHLCD_VP_QUEUE) RTS_Flush(true);
+    i = 0;
+    while (i < vp_count && vp_pending[i].addr < addr) i++;
+  }
+  memmove(&vp_pending[i + 1], &vp_pending[i], (vp_count - i) * sizeof(vp_word_t));
+  vp_pending[i].addr = addr;
+  vp_pending[i].value = value;
+  vp_count++;
+}
+
+// Move as many queued writes as fit to the transmit buffer
+void RTSSHOW::vp_commit()
+{
+  uint8_t frame[6 + 2 * VP_FRAME_WORDS];
+  uint8_t i = 0;
+  while (i < vp_count) {
+    uint8_t n = 1;
+    while (i + n < vp_count && n < VP_FRAME_WORDS && vp_pending[i + n].addr == vp_pending[i].addr + n) n++;
+
+    frame[0] = FHONE;
+    frame[1] = FHTWO;
+    frame[2] = 3 + 2 * n;
+    frame[3] = VarAddr_W;
+    frame[4] = vp_pending[i].addr >> 8;
+    frame[5] = vp_pending[i].addr & 0xFF;
+    LOOP_L_N(j, n) {
+      frame[6 + 2 * j] = vp_pending[i + j].value >> 8;
+      frame[7 + 2 * j] = vp_pending[i + j].value & 0xFF;
+    }
+    if (!tx_put(frame, 6 + 2 * n)) break;
+
+    LOOP_L_N(j, n) {
+      const vp_word_t &w = vp_pending[i + j];
+      vp_shadow[w.addr % VP_SHADOW_SIZE] = w;
+    }
+    i += n;
+  }
+  vp_count -= i;
+  memmove(vp_pending, &vp_pending[i], vp_count * sizeof(vp_word_t));
+}
+
+// Forget what the screen shows for variables it may have changed
+void RTSSHOW::vp_invalidate(const uint16_t addr, const uint16_t words)
+{
+  for (uint32_t a = addr; a < uint32_t(addr) + words; a++) {
+    vp_word_t &shadow = vp_shadow[a % VP_SHADOW_SIZE];
+    if (shadow.addr == a) shadow.addr = 0;
+  }
+}
+
+uint16_t RTSSHOW::tx_room()
+{
+  return (tx_tail + DWIN_TOUCHLCD_TX_BUFFER_SIZE - 1 - tx_head) % DWIN_TOUCHLCD_TX_BUFFER_SIZE;
+}
+
+// Add bytes to the transmit buffer. Return false, adding nothing, if they don't fit.
+bool RTSSHOW::tx_put(const uint8_t *data, const uint16_t len)
+{
+  if (len > tx_room()) return false;
+  for (uint16_t i = 0; i < len; i++) {
+    tx_buffer[tx_head] = data[i];
+    tx_head = (tx_head + 1) % DWIN_TOUCHLCD_TX_BUFFER_SIZE;
+  }
+  return true;
+}
+
+// Hand the USART what it will take. Return true when nothing is left.
+bool RTSSHOW::tx_send()
+{
+  while (tx_tail != tx_head) {
+    const uint16_t end = tx_head > tx_tail ? tx_head : DWIN_TOUCHLCD_TX_BUFFER_SIZE;
+    const uint32_t sent = usart_tx(MYSERIAL1.c_dev(), &tx_buffer[tx_tail], end - tx_tail);
+    if (!sent) return false;
+    tx_tail = (tx_tail + sent) % DWIN_TOUCHLCD_TX_BUFFER_SIZE;
+  }
+  return true;
+}
+
+// Queue any other frame behind the writes queued before it
+void RTSSHOW::tx_frame(const uint8_t *data, const uint16_t len)
+{
+  vp_commit();
+  if (vp_count || !tx_put(data, len)) {
+    // The buffer is full, so the writes before the frame must go out first
+    RTS_Flush(true);
+    for (uint16_t i = 0; i < len;) {
+      const uint16_t n = _MIN(uint16_t(len - i), tx_room());
+      tx_put(&data[i], n);
+      i += n;
+      if (i < len) RTS_Flush(true);   // Larger than the whole buffer
+    }
+  }
+  tx_send();
+}
+
+// Send what the USART will take, or with 'wait' everything queued
+void RTSSHOW::RTS_Flush(const bool wait/*=false*/)
+{
+  bool done;
+  do {
+    vp_commit();
+    done = tx_send() && !vp_count;
+  } while (wait && !done);
+}
+
+#endif // DWIN_TOUCHLCD_VP_QUEUE
+
 void RTSSHOW::RTS_SndData(void)
 {
+  #ifdef DWIN_TOUCHLCD_VP_QUEUE
+    if(snddat.command == VarAddr_W && snddat.addr >= VP_USER_BASE && snddat.len >= 5)
+    {
+      for(int i = 0;i < (snddat.len - 3) / 2;i ++)
+      {
+        vp_write(snddat.addr + i, snddat.data[i]);
+      }
+      memset(&snddat, 0, sizeof(snddat));
+      snddat.head[0] = FHONE;
+      snddat.head[1] = FHTWO;
+      return;
+    }
+  #endif
+
   if((snddat.head[0] == FHONE) && (snddat.head[1] == FHTWO) && (snddat.len >= 3))
   {
     databuf[0] = snddat.head[0];
@@ -492,8 +646,12 @@ void RTSSHOW::RTS_SndData(void)
     //   MYSERIAL1.write(databuf[i]);
     //   delayMicroseconds(1);
     // }
-    usart_tx(MYSERIAL1.c_dev(), databuf, snddat.len + 3);
-    MYSERIAL1.flush();
+    #ifdef DWIN_TOUCHLCD_VP_QUEUE
+      tx_frame(databuf, snddat.len + 3);
+    #else
+      usart_tx(MYSERIAL1.c_dev(), databuf, snddat.len + 3);
+      MYSERIAL1.flush();
+    #endif
 
     memset(&snddat, 0, sizeof(snddat));
     memset(databuf, 0, sizeof(databuf));
@@ -516,23 +674,37 @@ void RTSSHOW::RTS_SndData(const char *str, unsigned long addr, unsigned char cmd
   int len = strlen(str);
   if(len > 0)
   {
-    databuf[0] = FHONE;
-    databuf[1] = FHTWO;
-    databuf[2] = 3+len;
-    databuf[3] = cmd;
-    databuf[4] = addr >> 8;
-    databuf[5] = addr & 0x00FF;
-    for(int i = 0;i < len;i ++)
-    {
-      databuf[6 + i] = str[i];
-    }
+    #ifdef DWIN_TOUCHLCD_VP_QUEUE
+      uint8_t frame[6 + 252];
+      NOMORE(len, int(sizeof(frame)) - 6);
+      frame[0] = FHONE;
+      frame[1] = FHTWO;
+      frame[2] = 3 + len;
+      frame[3] = cmd;
+      frame[4] = addr >> 8;
+      frame[5] = addr & 0xFF;
+      memcpy(&frame[6], str, len);
+      tx_frame(frame, 6 + len);
+      vp_invalidate(addr, (len + 1) / 2);
+    #else
+      databuf[0] = FHONE;
+      databuf[1] = FHTWO;
+      databuf[2] = 3+len;
+      databuf[3] = cmd;
+      databuf[4] = addr >> 8;
+      databuf[5] = addr & 0x00FF;
+      for(int i = 0;i < len;i ++)
+      {
+        databuf[6 + i] = str[i];
+      }
 
-    for(int i = 0;i < (len + 6);i ++)
-    {
-      MYSERIAL1.write(databuf[i]);
-      delayMicroseconds(1);
-    }
-    memset(databuf, 0, sizeof(databuf));
+      for(int i = 0;i < (len + 6);i ++)
+      {
+        MYSERIAL1.write(databuf[i]);
+        delayMicroseconds(1);
+      }
+      memset(databuf, 0, sizeof(databuf));
+    #endif
   }
 }
 
@@ -1572,6 +1744,9 @@ void RTSUpdate()
   {
     rtscheck.RTS_HandleData();
   }
+
+  // send the values updated above
+  rtscheck.RTS_Flush();
 }
 
 void ErrorHanding()
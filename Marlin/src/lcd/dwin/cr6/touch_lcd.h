@@ -43,6 +43,10 @@
 
 #define SizeofDatabuf       26
 
+#define VP_USER_BASE        0x1000  // Below this are the screen's system variables
+#define VP_SHADOW_SIZE      128     // Last values sent, to skip unchanged writes
+#define VP_FRAME_WORDS      32      // Most words written by one frame
+
 #define Z_VALUE_EEPROM   500
 
 #define Retry_num   2
@@ -248,6 +252,12 @@ class RTSSHOW {
     void refresh_page();
     inline bool has_fatal_error() { return m_current_page == DWINTouchPage::ERR_FATAL_UNSPECIFIED; };
 
+    #ifdef DWIN_TOUCHLCD_VP_QUEUE
+      void RTS_Flush(const bool wait=false);
+    #else
+      inline void RTS_Flush(const bool=false) {}
+    #endif
+
     DB recdat;
     DB snddat;
 
@@ -255,6 +265,25 @@ class RTSSHOW {
   private:
     unsigned char databuf[SizeofDatabuf];
 
+    #ifdef DWIN_TOUCHLCD_VP_QUEUE
+      typedef struct { uint16_t addr, value; } vp_word_t;
+
+      vp_word_t vp_pending[DWIN_TOUCHLCD_VP_QUEUE];   // Queued writes, sorted by address
+      vp_word_t vp_shadow[VP_SHADOW_SIZE];            // What the screen shows, by address modulo size
+      uint8_t vp_count;
+
+      uint8_t tx_buffer[DWIN_TOUCHLCD_TX_BUFFER_SIZE];
+      uint16_t tx_head, tx_tail;
+
+      void vp_write(const uint16_t addr, const uint16_t value);
+      void vp_commit();
+      void vp_invalidate(const uint16_t addr, const uint16_t words);
+      uint16_t tx_room();
+      bool tx_put(const uint8_t *data, const uint16_t len);
+      bool tx_send();
+      void tx_frame(const uint8_t *data, const uint16_t len);
+    #endif
+
     DWINTouchPage m_current_page;
   };
 
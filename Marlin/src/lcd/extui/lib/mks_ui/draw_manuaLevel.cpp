@@ -50,7 +50,7 @@ static void event_handler(lv_obj_t * obj, lv_event_t event) {
       }
       else if (event == LV_EVENT_RELEASED) {
 
-        if (queue.length == 0) {
+        if (queue.ring.empty()) {
           if (uiCfg.leveling_first_time) {
             queue.enqueue_now_P(PSTR("G28"));
             uiCfg.leveling_first_time = 0;
@@ -70,7 +70,7 @@ static void event_handler(lv_obj_t * obj, lv_event_t event) {
         // nothing to do
       }
       else if (event == LV_EVENT_RELEASED) {
-        if (queue.length == 0) {
+        if (queue.ring.empty()) {
           if (uiCfg.leveling_first_time) {
             queue.enqueue_now_P(PSTR("G28"));
             uiCfg.leveling_first_time = 0;
@@ -90,7 +90,7 @@ static void event_handler(lv_obj_t * obj, lv_event_t event) {
         // nothing to do
       }
       else if (event == LV_EVENT_RELEASED) {
-        if (queue.length == 0) {
+        if (queue.ring.empty()) {
           if (uiCfg.leveling_first_time) {
             queue.enqueue_now_P(PSTR("G28"));
             uiCfg.leveling_first_time = 0;
@@ -111,7 +111,7 @@ static void event_handler(lv_obj_t * obj, lv_event_t event) {
         // nothing to do
       }
       else if (event == LV_EVENT_RELEASED) {
-        if (queue.length == 0) {
+        if (queue.ring.empty()) {
           if (uiCfg.leveling_first_time) {
             queue.enqueue_now_P(PSTR("G28"));
             uiCfg.leveling_first_time = 0;
@@ -131,7 +131,7 @@ static void event_handler(lv_obj_t * obj, lv_event_t event) {
         // nothing to do
       }
       else if (event == LV_EVENT_RELEASED) {
-        if (queue.length == 0) {
+        if (queue.ring.empty()) {
           if (uiCfg.leveling_first_time) {
             queue.enqueue_now_P(PSTR("G28"));
             uiCfg.leveling_first_time = 0;
@@ -33,12 +33,20 @@ uint8_t *TFT_Queue::end_of_queue = queue;
 uint8_t *TFT_Queue::current_task = NULL;
 uint8_t *TFT_Queue::last_task = NULL;
 
+#if ENABLED(TFT_SKIP_UNCHANGED_AREAS)
+  drawnArea_t TFT_Queue::areas[TFT_AREA_CACHE_SIZE], TFT_Queue::pending_area;
+  uint8_t TFT_Queue::next_area;
+  uint32_t TFT_Queue::frame_us, TFT_Queue::frames, TFT_Queue::frame_us_max, TFT_Queue::pixels_drawn, TFT_Queue::pixels_skipped;
+  uint64_t TFT_Queue::frame_us_total;
+#endif
+
 void TFT_Queue::reset() {
   tft.abort();
 
   end_of_queue = queue;
   current_task = NULL;
   last_task = NULL;
+  TERN_(TFT_SKIP_UNCHANGED_AREAS, pending_area.width = 0); // An aborted task may be half drawn
 }
 
 void TFT_Queue::async() {
@@ -48,20 +56,110 @@ void TFT_Queue::async() {
   // Check IO busy status
   if (tft.is_busy()) return;
 
+  TERN_(TFT_SKIP_UNCHANGED_AREAS, const uint32_t start_us = micros());
+
   if (task->state == TASK_STATE_COMPLETED) {
+    TERN_(TFT_SKIP_UNCHANGED_AREAS, area_drawn());
     task = (queueTask_t *)task->nextTask;
     current_task = (uint8_t *)task;
   }
 
   finish_sketch();
 
+  #if ENABLED(TFT_SKIP_UNCHANGED_AREAS)
+    // Pass over the tasks that would draw what is already on the screen
+    while (task->type != TASK_END_OF_QUEUE && task->state == TASK_STATE_READY && unchanged(task)) {
+      task = (queueTask_t *)task->nextTask;
+      current_task = (uint8_t *)task;
+    }
+  #endif
+
   switch (task->type) {
-    case TASK_END_OF_QUEUE: reset();      break;
+    case TASK_END_OF_QUEUE:
+      #if ENABLED(TFT_SKIP_UNCHANGED_AREAS)
+        frame_us += micros() - start_us;
+        frames++;
+        frame_us_total += frame_us;
+        NOLESS(frame_us_max, frame_us);
+        frame_us = 0;
+      #endif
+      reset();
+      return;
     case TASK_FILL:         fill(task);   break;
     case TASK_CANVAS:       canvas(task); break;
   }
+
+  TERN_(TFT_SKIP_UNCHANGED_AREAS, frame_us += micros() - start_us);
 }
 
+#if ENABLED(TFT_SKIP_UNCHANGED_AREAS)
+
+  static inline bool areas_overlap(const drawnArea_t &a, const drawnArea_t &b) {
+    return a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height && b.y < a.y + a.height;
+  }
+
+  /**
+   * Return true if the screen area of a ready task already shows what it would draw.
+   * Otherwise forget the areas it will draw over, and keep it to be remembered
+   * once it completes.
+   */
+  bool TFT_Queue::unchanged(queueTask_t *task) {
+    // Fill and canvas tasks both start with x, y, width and height
+    const parametersCanvas_t *rect = (parametersCanvas_t *)(((uint8_t *)task) + sizeof(queueTask_t));
+    drawnArea_t area = { rect->x, rect->y, rect->width, rect->height, 2166136261UL };
+
+    // FNV-1a of the task parameters, and of the font a canvas draws text in
+    auto hash = [&](const void * const data, uint16_t size) {
+      for (const uint8_t *byte = (const uint8_t *)data; size--;) area.hash = (area.hash ^ *byte++) * 16777619UL;
+    };
+    hash(&task->type, sizeof(task->type));
+    if (task->type == TASK_CANVAS) {
+      const font_t * const font = TFT_String::font();
+      hash(&font, sizeof(font));
+    }
+    hash(rect, task->nextTask - (uint8_t *)rect);
+
+    const uint32_t pixels = uint32_t(area.width) * area.height;
+    LOOP_L_N(i, TFT_AREA_CACHE_SIZE) {
+      const drawnArea_t &a = areas[i];
+      if (a.width && a.hash == area.hash && a.x == area.x && a.y == area.y && a.width == area.width && a.height == area.height) {
+        task->state = TASK_STATE_COMPLETED;
+        pixels_skipped += pixels;
+        return true;
+      }
+    }
+
+    LOOP_L_N(i, TFT_AREA_CACHE_SIZE)
+      if (areas[i].width && areas_overlap(areas[i], area)) areas[i].width = 0;
+
+    pending_area = area;
+    pixels_drawn += pixels;
+    return false;
+  }
+
+  // Remember the area of the completed task, in a free slot or over the oldest
+  void TFT_Queue::area_drawn() {
+    if (!pending_area.width) return;
+    uint8_t slot = next_area;
+    LOOP_L_N(i, TFT_AREA_CACHE_SIZE) if (!areas[i].width) { slot = i; break; }
+    if (slot == next_area) next_area = (next_area + 1) % (TFT_AREA_CACHE_SIZE);
+    areas[slot] = pending_area;
+    pending_area.width = 0;
+  }
+
+  void TFT_Queue::reset_stats() {
+    frames = frame_us_max = pixels_drawn = pixels_skipped = 0;
+    frame_us_total = 0;
+  }
+
+  void TFT_Queue::report() {
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPAIR("TFT frames: ", frames, ", avg ", frames ? uint32_t(frame_us_total / frames) : 0UL, "us, max ", frame_us_max);
+    SERIAL_ECHOLNPAIR("us, pixels drawn ", pixels_drawn, ", skipped ", pixels_skipped);
+  }
+
+#endif // TFT_SKIP_UNCHANGED_AREAS
+
 void TFT_Queue::finish_sketch() {
   if (last_task == NULL) return;
   queueTask_t *task = (queueTask_t *)last_task;
@@ -231,6 +329,7 @@ void TFT_Queue::add_text(uint16_t x, uint16_t y, uint16_t color, uint8_t *string
   parameters->x = x;
   parameters->y = y;
   parameters->color = color;
+  parameters->count = 0;
   parameters->stringLength = 0;
   parameters->maxWidth = maxWidth;
 
@@ -111,6 +111,17 @@ typedef struct __attribute__((__packed__)) {
   uint16_t color;
 } parametersCanvasRectangle_t;
 
+#if ENABLED(TFT_SKIP_UNCHANGED_AREAS)
+  // An area of the screen and a hash of the task that drew it
+  typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+    uint32_t hash;
+  } drawnArea_t;
+#endif
+
 class TFT_Queue {
   private:
     static uint8_t queue[QUEUE_SIZE];
@@ -122,8 +133,23 @@ class TFT_Queue {
     static void fill(queueTask_t *task);
     static void canvas(queueTask_t *task);
 
+    #if ENABLED(TFT_SKIP_UNCHANGED_AREAS)
+      static drawnArea_t areas[TFT_AREA_CACHE_SIZE];
+      static drawnArea_t pending_area;  // The task being drawn, remembered when it completes
+      static uint8_t next_area;
+      static uint32_t frame_us, frames, frame_us_max, pixels_drawn, pixels_skipped;
+      static uint64_t frame_us_total;
+
+      static bool unchanged(queueTask_t *task);
+      static void area_drawn();
+    #endif
+
   public:
     static void reset();
+    #if ENABLED(TFT_SKIP_UNCHANGED_AREAS)
+      static void report();
+      static void reset_stats();
+    #endif
     static void async();
     static void sync() { while (current_task != NULL) async(); }
 
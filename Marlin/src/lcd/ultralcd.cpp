@@ -118,6 +118,7 @@ constexpr uint8_t epps = ENCODER_PULSES_PER_STEP;
 
 #if HAS_GRAPHICAL_LCD
   #include "dogm/ultralcd_DOGM.h"
+  #include "dogm/u8g_page_cache.h"
 #endif
 
 #include "lcdprint.h"
@@ -1018,7 +1019,10 @@ void MarlinUI::update() {
           const bool in_status = on_status_screen(),
                      do_u8g_loop = !in_status;
           lcd_in_status(in_status);
-          if (in_status) status_screen();
+          if (in_status) {
+            status_screen();
+            TERN_(DOGM_SKIP_UNCHANGED_PAGES, u8g_page_cache_clear()); // The lightweight screen doesn't use u8g pages
+          }
         #else
           constexpr bool do_u8g_loop = true;
         #endif
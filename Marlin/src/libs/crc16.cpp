@@ -22,6 +22,10 @@
 
 #include "crc16.h"
 
+// CRC-16/XMODEM, polynomial 0x1021, with the initial value passed in
+
+#ifdef __AVR__
+
 void crc16(uint16_t *crc, const void * const data, uint16_t cnt) {
   uint8_t *ptr = (uint8_t *)data;
   while (cnt--) {
@@ -30,3 +34,46 @@ void crc16(uint16_t *crc, const void * const data, uint16_t cnt) {
       *crc = (uint16_t)((*crc & 0x8000) ? ((uint16_t)(*crc << 1) ^ 0x1021) : (*crc << 1));
   }
 }
+
+#else
+
+/**
+ * Slicing-by-4: table k holds the CRC of a byte followed by k zero bytes,
+ * so four bytes fold into the CRC with four lookups. The tables (2K) are
+ * built at compile time.
+ */
+constexpr uint16_t crc16_shift(const uint16_t c, const uint8_t bits=8) {
+  return bits ? crc16_shift(uint16_t((c & 0x8000) ? (c << 1) ^ 0x1021 : c << 1), bits - 1) : c;
+}
+
+constexpr uint16_t crc16_zeros(const uint16_t c, const uint8_t k) {
+  return k ? crc16_zeros(uint16_t(c << 8) ^ crc16_shift(c & 0xFF00), k - 1) : c;
+}
+
+typedef struct { uint16_t t[4][256]; } crc16_table_t;
+
+template<int...> struct crc16_seq {};
+template<int N, int... I> struct crc16_make_seq : crc16_make_seq<N - 1, N - 1, I...> {};
+template<int... I> struct crc16_make_seq<0, I...> { typedef crc16_seq<I...> type; };
+
+template<int... I>
+constexpr crc16_table_t crc16_make_table(crc16_seq<I...>) {
+  return { {
+    { crc16_zeros(crc16_shift(I << 8), 0)... }, { crc16_zeros(crc16_shift(I << 8), 1)... },
+    { crc16_zeros(crc16_shift(I << 8), 2)... }, { crc16_zeros(crc16_shift(I << 8), 3)... }
+  } };
+}
+
+static constexpr crc16_table_t crc16_table = crc16_make_table(crc16_make_seq<256>::type());
+
+void crc16(uint16_t *crc, const void * const data, uint16_t cnt) {
+  const uint8_t *ptr = (const uint8_t *)data;
+  const uint16_t (&t)[4][256] = crc16_table.t;
+  uint16_t c = *crc;
+  for (; cnt >= 4; cnt -= 4, ptr += 4)
+    c = t[3][(c >> 8) ^ ptr[0]] ^ t[2][(c & 0xFF) ^ ptr[1]] ^ t[1][ptr[2]] ^ t[0][ptr[3]];
+  while (cnt--) c = uint16_t(c << 8) ^ t[0][(c >> 8) ^ *ptr++];
+  *crc = c;
+}
+
+#endif
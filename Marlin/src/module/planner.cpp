@@ -130,6 +130,14 @@ volatile uint8_t Planner::block_buffer_head,    // Index of the next block to be
 uint16_t Planner::cleaning_buffer_counter;      // A counter to disable queuing of blocks
 uint8_t Planner::delay_before_delivering;       // This counter delays delivery of blocks when queue becomes empty to allow the opportunity of merging blocks
 
+#if ENABLED(INCREMENTAL_PLANNER)
+  uint8_t Planner::block_buffer_dirty;          // Index of the last block left unchanged by the reverse pass
+#endif
+
+#if ENABLED(PLANNER_RECALC_STATS)
+  planner_recalc_stats_t Planner::recalc_stats;
+#endif
+
 planner_settings_t Planner::settings;           // Initialized by settings.load()
 
 #if ENABLED(LASER_POWER_INLINE)
@@ -234,7 +242,7 @@ float Planner::previous_nominal_speed_sqr;
   xyze_pos_t Planner::position_cart;
 #endif
 
-#if HAS_SPI_LCD
+#if HAS_BLOCK_BUFFER_RUNTIME
   volatile uint32_t Planner::block_buffer_runtime_us = 0;
 #endif
 
@@ -714,8 +722,6 @@ void Planner::init() {
   #endif
 #endif
 
-#define MINIMAL_STEP_RATE 120
-
 /**
  * Get the current block for processing
  * and mark the block as busy.
@@ -747,7 +753,7 @@ block_t* Planner::get_current_block() {
     if (TEST(block->flag, BLOCK_BIT_RECALCULATE)) return nullptr;
 
     // We can't be sure how long an active block will take, so don't count it.
-    TERN_(HAS_SPI_LCD, block_buffer_runtime_us -= block->segment_time_us);
+    TERN_(HAS_BLOCK_BUFFER_RUNTIME, block_buffer_runtime_us -= block->segment_time_us);
 
     // As this block is busy, advance the nonbusy block pointer
     block_buffer_nonbusy = next_block_index(block_buffer_tail);
@@ -761,14 +767,86 @@ block_t* Planner::get_current_block() {
   }
 
   // The queue became empty
-  TERN_(HAS_SPI_LCD, clear_block_buffer_runtime()); // paranoia. Buffer is empty now - so reset accumulated time to zero.
+  TERN_(HAS_BLOCK_BUFFER_RUNTIME, clear_block_buffer_runtime()); // paranoia. Buffer is empty now - so reset accumulated time to zero.
 
   return nullptr;
 }
 
+#if ENABLED(PLANNER_FIXED_POINT)
+
+  uint32_t Planner::isqrt(uint32_t v) {
+    uint32_t res = 0, bit = 1UL << 30;
+    while (bit > v) bit >>= 2;
+    while (bit) {
+      if (v >= res + bit) { v -= res + bit; res = (res >> 1) + bit; }
+      else res >>= 1;
+      bit >>= 2;
+    }
+    return res;
+  }
+
+  uint32_t Planner::speed_sqr_to_rate(const block_t * const block, const speed_sqr_t speed_sqr) {
+    // Take the root with 8 fractional bits below 256mm/s, or 4 above, so the speed fits in 16 bits
+    const uint8_t fract = speed_sqr < (1UL << 24) ? 8 : 4;
+    const uint32_t speed = isqrt(speed_sqr << (2 * fract - (SPEED_SQR_FRACT)));
+
+    // Multiply by the Q16.16 rate per speed in 16-bit halves
+    const uint32_t lo = speed * (block->rate_per_speed & 0xFFFF),
+                   hi = speed * (block->rate_per_speed >> 16),
+                   rate = hi + (lo >> 16);
+    if (rate < hi) return UINT32_MAX;
+    return (rate >> fract) + ((rate & ((1UL << fract) - 1)) || (lo & 0xFFFF) ? 1 : 0);
+  }
+
+  // Divide, rounding up or down
+  static inline uint32_t div_steps(const uint32_t num, const uint32_t den, const bool round_up) {
+    if (!den) return 0;
+    const uint32_t q = num / den;
+    return round_up && q * den != num ? q + 1 : q;
+  }
+
+  // Rates up to this have squares that fit in 32 bits. Faster ones use float.
+  #define FIXED_RATE_MAX 0xFFFFUL
+
+  uint32_t Planner::acceleration_steps(const uint32_t initial_rate, const uint32_t target_rate, const uint32_t accel, const bool round_up) {
+    if (target_rate <= initial_rate) return 0;
+    if (target_rate > FIXED_RATE_MAX) {
+      const float steps = estimate_acceleration_distance(initial_rate, target_rate, accel);
+      return round_up ? CEIL(steps) : FLOOR(steps);
+    }
+    return div_steps((target_rate - initial_rate) * (target_rate + initial_rate), accel * 2, round_up);
+  }
+
+  uint32_t Planner::intersection_steps(const uint32_t initial_rate, const uint32_t final_rate, const uint32_t accel, const uint32_t steps) {
+    if (!accel) return 0;
+    if (_MAX(initial_rate, final_rate) > FIXED_RATE_MAX)
+      return _MIN(uint32_t(_MAX(CEIL(intersection_distance(initial_rate, final_rate, accel, steps)), 0)), steps);
+
+    // (2 * accel * steps - initial_rate² + final_rate²) / (4 * accel) as steps / 2 + (final_rate² - initial_rate²) / (4 * accel)
+    const uint32_t den = accel * 4, odd = TEST(steps, 0) ? accel * 2 : 0;
+    uint32_t n = steps >> 1;
+    if (final_rate >= initial_rate) {
+      const uint32_t diff = (final_rate - initial_rate) * (final_rate + initial_rate);
+      n += diff / den + div_steps(diff % den + odd, den, true);
+    }
+    else {
+      const uint32_t diff = (initial_rate - final_rate) * (initial_rate + final_rate);
+      if (diff <= odd)
+        n += div_steps(odd - diff, den, true);
+      else {
+        const uint32_t back = (diff - odd) / den;
+        n = back < n ? n - back : 0;
+      }
+    }
+    return _MIN(n, steps);
+  }
+
+#endif // PLANNER_FIXED_POINT
+
 /**
  * Calculate trapezoid parameters, multiplying the entry- and exit-speeds
- * by the provided factors.
+ * by the provided factors. With PLANNER_FIXED_POINT the entry and exit
+ * speeds squared are given instead.
  **
  * ############ VERY IMPORTANT ############
  * NOTE that the PRECONDITION to call this function is that the block is
@@ -776,10 +854,21 @@ block_t* Planner::get_current_block() {
  * is not and will not use the block while we modify it, so it is safe to
  * alter its values.
  */
-void Planner::calculate_trapezoid_for_block(block_t* const block, const float &entry_factor, const float &exit_factor) {
+#if ENABLED(PLANNER_FIXED_POINT)
+
+  void Planner::calculate_trapezoid_for_block(block_t* const block, const speed_sqr_t entry_speed_sqr, const speed_sqr_t exit_speed_sqr) {
+
+    uint32_t initial_rate = _MIN(speed_sqr_to_rate(block, entry_speed_sqr), block->nominal_rate),
+             final_rate = _MIN(speed_sqr_to_rate(block, exit_speed_sqr), block->nominal_rate); // (steps per second)
+
+#else
+
+  void Planner::calculate_trapezoid_for_block(block_t* const block, const float &entry_factor, const float &exit_factor) {
 
-  uint32_t initial_rate = CEIL(block->nominal_rate * entry_factor),
-           final_rate = CEIL(block->nominal_rate * exit_factor); // (steps per second)
+    uint32_t initial_rate = CEIL(block->nominal_rate * entry_factor),
+             final_rate = CEIL(block->nominal_rate * exit_factor); // (steps per second)
+
+#endif
 
   // Limit minimal step rate (Otherwise the timer will overflow.)
   NOLESS(initial_rate, uint32_t(MINIMAL_STEP_RATE));
@@ -791,9 +880,15 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
 
   const int32_t accel = block->acceleration_steps_per_s2;
 
-          // Steps required for acceleration, deceleration to/from nominal rate
-  uint32_t accelerate_steps = CEIL(estimate_acceleration_distance(initial_rate, block->nominal_rate, accel)),
-           decelerate_steps = FLOOR(estimate_acceleration_distance(block->nominal_rate, final_rate, -accel));
+  #if ENABLED(PLANNER_FIXED_POINT)
+            // Steps required for acceleration, deceleration to/from nominal rate
+    uint32_t accelerate_steps = acceleration_steps(initial_rate, block->nominal_rate, accel, true),
+             decelerate_steps = acceleration_steps(final_rate, block->nominal_rate, accel, false);
+  #else
+            // Steps required for acceleration, deceleration to/from nominal rate
+    uint32_t accelerate_steps = CEIL(estimate_acceleration_distance(initial_rate, block->nominal_rate, accel)),
+             decelerate_steps = FLOOR(estimate_acceleration_distance(block->nominal_rate, final_rate, -accel));
+  #endif
           // Steps between acceleration and deceleration, if any
   int32_t plateau_steps = block->step_event_count - accelerate_steps - decelerate_steps;
 
@@ -802,13 +897,25 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
   // Use intersection_distance() to calculate accel / braking time in order to
   // reach the final_rate exactly at the end of this block.
   if (plateau_steps < 0) {
-    const float accelerate_steps_float = CEIL(intersection_distance(initial_rate, final_rate, accel, block->step_event_count));
-    accelerate_steps = _MIN(uint32_t(_MAX(accelerate_steps_float, 0)), block->step_event_count);
+    #if ENABLED(PLANNER_FIXED_POINT)
+      accelerate_steps = intersection_steps(initial_rate, final_rate, accel, block->step_event_count);
+    #else
+      const float accelerate_steps_float = CEIL(intersection_distance(initial_rate, final_rate, accel, block->step_event_count));
+      accelerate_steps = _MIN(uint32_t(_MAX(accelerate_steps_float, 0)), block->step_event_count);
+    #endif
     plateau_steps = 0;
 
     #if ENABLED(S_CURVE_ACCELERATION)
       // We won't reach the cruising rate. Let's calculate the speed we will reach
-      cruise_rate = final_speed(initial_rate, accel, accelerate_steps);
+      #if ENABLED(PLANNER_FIXED_POINT)
+        const uint32_t initial_sqr = initial_rate * initial_rate;
+        if (initial_rate <= FIXED_RATE_MAX && accelerate_steps <= (UINT32_MAX - initial_sqr) / (uint32_t(accel) * 2))
+          cruise_rate = _MIN(isqrt(initial_sqr + uint32_t(accel) * 2 * accelerate_steps), block->nominal_rate);
+        else
+          cruise_rate = _MIN(uint32_t(final_speed(initial_rate, accel, accelerate_steps)), block->nominal_rate);
+      #else
+        cruise_rate = final_speed(initial_rate, accel, accelerate_steps);
+      #endif
     #endif
   }
   #if ENABLED(S_CURVE_ACCELERATION)
@@ -825,6 +932,9 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
              deceleration_time_inverse = get_period_inverse(deceleration_time);
   #endif
 
+  // Any prepared stepper state is now stale
+  TERN_(STEPPER_BLOCK_PREP, CBI(block->flag, BLOCK_BIT_PREPARED));
+
   // Store new block parameters
   block->accelerate_until = accelerate_steps;
   block->decelerate_after = accelerate_steps + plateau_steps;
@@ -943,13 +1053,14 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
 */
 
 // The kernel called by recalculate() when scanning the plan from last to first entry.
-void Planner::reverse_pass_kernel(block_t* const current, const block_t * const next) {
+// Return 'true' if the entry speed of the block was changed.
+bool Planner::reverse_pass_kernel(block_t* const current, const block_t * const next) {
   if (current) {
     // If entry speed is already at the maximum entry speed, and there was no change of speed
     // in the next block, there is no need to recheck. Block is cruising and there is no need to
     // compute anything for this block,
     // If not, block entry speed needs to be recalculated to ensure maximum possible planned speed.
-    const float max_entry_speed_sqr = current->max_entry_speed_sqr;
+    const speed_sqr_t max_entry_speed_sqr = current->max_entry_speed_sqr;
 
     // Compute maximum entry speed decelerating over the current block from its exit speed.
     // If not at the maximum entry speed, or the previous block entry speed changed
@@ -963,9 +1074,9 @@ void Planner::reverse_pass_kernel(block_t* const current, const block_t * const
       // the reverse and forward planners, the corresponding block junction speed will always be at the
       // the maximum junction speed and may always be ignored for any speed reduction checks.
 
-      const float new_entry_speed_sqr = TEST(current->flag, BLOCK_BIT_NOMINAL_LENGTH)
+      const speed_sqr_t new_entry_speed_sqr = TEST(current->flag, BLOCK_BIT_NOMINAL_LENGTH)
         ? max_entry_speed_sqr
-        : _MIN(max_entry_speed_sqr, max_allowable_speed_sqr(-current->acceleration, next ? next->entry_speed_sqr : sq(float(MINIMUM_PLANNER_SPEED)), current->millimeters));
+        : _MIN(max_entry_speed_sqr, allowable_entry_speed_sqr(current, next ? next->entry_speed_sqr : min_planner_speed_sqr));
       if (current->entry_speed_sqr != new_entry_speed_sqr) {
 
         // Need to recalculate the block speed - Mark it now, so the stepper
@@ -984,10 +1095,12 @@ void Planner::reverse_pass_kernel(block_t* const current, const block_t * const
           // Block is not BUSY so this is ahead of the Stepper ISR:
           // Just Set the new entry speed.
           current->entry_speed_sqr = new_entry_speed_sqr;
+          return true;
         }
       }
     }
   }
+  return false;
 }
 
 /**
@@ -1002,6 +1115,9 @@ void Planner::reverse_pass() {
   // The ISR may change it so get a stable local copy.
   uint8_t planned_block_index = block_buffer_planned;
 
+  // Unless stopped early, the whole plan from the planned block onward may change
+  TERN_(INCREMENTAL_PLANNER, block_buffer_dirty = planned_block_index);
+
   // If there was a race condition and block_buffer_planned was incremented
   //  or was pointing at the head (queue empty) break loop now and avoid
   //  planning already consumed blocks
@@ -1018,7 +1134,21 @@ void Planner::reverse_pass() {
 
     // Only consider non sync and page blocks
     if (!TEST(current->flag, BLOCK_BIT_SYNC_POSITION) && !IS_PAGE(current)) {
-      reverse_pass_kernel(current, next);
+      TERN_(PLANNER_RECALC_STATS, recalc_stats.reverse_kernels++);
+      const bool changed = reverse_pass_kernel(current, next);
+
+      #if ENABLED(INCREMENTAL_PLANNER)
+        // The entry speed of the previous block is limited only by the entry speed of
+        // this block. If that didn't change then neither can any earlier junction, so
+        // the rest of the plan stays as it was and the reverse pass can stop here.
+        if (!changed) {
+          block_buffer_dirty = block_index;
+          return;
+        }
+      #else
+        UNUSED(changed);
+      #endif
+
       next = current;
     }
 
@@ -1050,7 +1180,7 @@ void Planner::forward_pass_kernel(const block_t* const previous, block_t* const
       previous->entry_speed_sqr < current->entry_speed_sqr) {
 
       // Compute the maximum allowable speed
-      const float new_entry_speed_sqr = max_allowable_speed_sqr(-previous->acceleration, previous->entry_speed_sqr, previous->millimeters);
+      const speed_sqr_t new_entry_speed_sqr = allowable_entry_speed_sqr(previous, previous->entry_speed_sqr);
 
       // If true, current block is full-acceleration and we can move the planned pointer forward.
       if (new_entry_speed_sqr < current->entry_speed_sqr) {
@@ -1104,6 +1234,14 @@ void Planner::forward_pass() {
   //  pass will never modify the values at the tail.
   uint8_t block_index = block_buffer_planned;
 
+  #if ENABLED(INCREMENTAL_PLANNER)
+    // Blocks before the one where the reverse pass stopped are unchanged
+    // and need no forward planning. Use it if the ISR hasn't passed it.
+    const uint8_t dirty_index = block_buffer_dirty;
+    if (BLOCK_MOD(dirty_index - block_index) < BLOCK_MOD(block_buffer_head - block_index))
+      block_index = dirty_index;
+  #endif
+
   block_t *block;
   const block_t * previous = nullptr;
   while (block_index != block_buffer_head) {
@@ -1118,8 +1256,10 @@ void Planner::forward_pass() {
       // the previous block became BUSY, so assume the current block's
       // entry speed can't be altered (since that would also require
       // updating the exit speed of the previous block).
-      if (!previous || !stepper.is_block_busy(previous))
+      if (!previous || !stepper.is_block_busy(previous)) {
+        TERN_(PLANNER_RECALC_STATS, if (previous) recalc_stats.forward_kernels++);
         forward_pass_kernel(previous, block, block_index);
+      }
       previous = block;
     }
     // Advance to the previous
@@ -1136,6 +1276,15 @@ void Planner::recalculate_trapezoids() {
   // The tail may be changed by the ISR so get a local copy.
   uint8_t block_index = block_buffer_tail,
           head_block_index = block_buffer_head;
+
+  #if ENABLED(INCREMENTAL_PLANNER)
+    // Only the trapezoids from the block before the first changed junction
+    // can differ. Start there, unless the ISR already passed it.
+    const uint8_t first_index = prev_block_index(block_buffer_dirty);
+    if (BLOCK_MOD(first_index - block_index) < BLOCK_MOD(head_block_index - block_index))
+      block_index = first_index;
+  #endif
+
   // Since there could be a sync block in the head of the queue, and the
   // next loop must not recalculate the head block (as it needs to be
   // specially handled), scan backwards to the first non-SYNC block.
@@ -1156,14 +1305,23 @@ void Planner::recalculate_trapezoids() {
 
   // Go from the tail (currently executed block) to the first block, without including it)
   block_t *block = nullptr, *next = nullptr;
-  float current_entry_speed = 0.0, next_entry_speed = 0.0;
+  #if ENABLED(PLANNER_FIXED_POINT)
+    speed_sqr_t current_entry_speed_sqr = 0, next_entry_speed_sqr = 0;
+  #else
+    float current_entry_speed = 0.0, next_entry_speed = 0.0;
+  #endif
   while (block_index != head_block_index) {
 
     next = &block_buffer[block_index];
 
     // Skip sync and page blocks
     if (!TEST(next->flag, BLOCK_BIT_SYNC_POSITION) && !IS_PAGE(next)) {
-      next_entry_speed = SQRT(next->entry_speed_sqr);
+      TERN_(PLANNER_RECALC_STATS, recalc_stats.trapezoid_kernels++);
+      #if ENABLED(PLANNER_FIXED_POINT)
+        next_entry_speed_sqr = next->entry_speed_sqr;
+      #else
+        next_entry_speed = SQRT(next->entry_speed_sqr);
+      #endif
 
       if (block) {
         // Recalculate if current block entry or exit junction speed has changed.
@@ -1180,12 +1338,21 @@ void Planner::recalculate_trapezoids() {
           if (!stepper.is_block_busy(block)) {
             // Block is not BUSY, we won the race against the Stepper ISR:
 
-            // NOTE: Entry and exit factors always > 0 by all previous logic operations.
-            const float current_nominal_speed = SQRT(block->nominal_speed_sqr),
-                        nomr = 1.0f / current_nominal_speed;
-            calculate_trapezoid_for_block(block, current_entry_speed * nomr, next_entry_speed * nomr);
+            #if ENABLED(PLANNER_FIXED_POINT)
+              calculate_trapezoid_for_block(block, current_entry_speed_sqr, next_entry_speed_sqr);
+            #else
+              // NOTE: Entry and exit factors always > 0 by all previous logic operations.
+              const float current_nominal_speed = SQRT(block->nominal_speed_sqr),
+                          nomr = 1.0f / current_nominal_speed;
+              calculate_trapezoid_for_block(block, current_entry_speed * nomr, next_entry_speed * nomr);
+            #endif
+            TERN_(PLANNER_RECALC_STATS, recalc_stats.trapezoids++);
             #if ENABLED(LIN_ADVANCE)
               if (block->use_advance_lead) {
+                #if ENABLED(PLANNER_FIXED_POINT)
+                  const float current_nominal_speed = SQRT(block->nominal_speed_sqr),
+                              next_entry_speed = SQRT(from_speed_sqr(next_entry_speed_sqr));
+                #endif
                 const float comp = block->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
                 block->max_adv_steps = current_nominal_speed * comp;
                 block->final_adv_steps = next_entry_speed * comp;
@@ -1200,7 +1367,7 @@ void Planner::recalculate_trapezoids() {
       }
 
       block = next;
-      current_entry_speed = next_entry_speed;
+      TERN(PLANNER_FIXED_POINT, current_entry_speed_sqr = next_entry_speed_sqr, current_entry_speed = next_entry_speed);
     }
 
     block_index = next_block_index(block_index);
@@ -1220,11 +1387,17 @@ void Planner::recalculate_trapezoids() {
     if (!stepper.is_block_busy(block)) {
       // Block is not BUSY, we won the race against the Stepper ISR:
 
-      const float next_nominal_speed = SQRT(next->nominal_speed_sqr),
-                  nomr = 1.0f / next_nominal_speed;
-      calculate_trapezoid_for_block(next, next_entry_speed * nomr, float(MINIMUM_PLANNER_SPEED) * nomr);
+      #if ENABLED(PLANNER_FIXED_POINT)
+        calculate_trapezoid_for_block(next, next_entry_speed_sqr, min_planner_speed_sqr);
+      #else
+        const float next_nominal_speed = SQRT(next->nominal_speed_sqr),
+                    nomr = 1.0f / next_nominal_speed;
+        calculate_trapezoid_for_block(next, next_entry_speed * nomr, float(MINIMUM_PLANNER_SPEED) * nomr);
+      #endif
+      TERN_(PLANNER_RECALC_STATS, recalc_stats.trapezoids++);
       #if ENABLED(LIN_ADVANCE)
         if (next->use_advance_lead) {
+          TERN_(PLANNER_FIXED_POINT, const float next_nominal_speed = SQRT(next->nominal_speed_sqr));
           const float comp = next->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
           next->max_adv_steps = next_nominal_speed * comp;
           next->final_adv_steps = (MINIMUM_PLANNER_SPEED) * comp;
@@ -1241,11 +1414,16 @@ void Planner::recalculate_trapezoids() {
 void Planner::recalculate() {
   // Initialize block index to the last block in the planner buffer.
   const uint8_t block_index = prev_block_index(block_buffer_head);
+  TERN_(PLANNER_RECALC_STATS, recalc_stats.recalculations++);
   // If there is just one block, no planning can be done. Avoid it!
   if (block_index != block_buffer_planned) {
     reverse_pass();
     forward_pass();
   }
+  #if ENABLED(INCREMENTAL_PLANNER)
+    else
+      block_buffer_dirty = block_index;
+  #endif
   recalculate_trapezoids();
 }
 
@@ -1578,7 +1756,7 @@ void Planner::quick_stop() {
   // forced to empty, there's no risk the ISR will touch this.
   delay_before_delivering = BLOCK_DELAY_FOR_1ST_MOVE;
 
-  #if HAS_SPI_LCD
+  #if HAS_BLOCK_BUFFER_RUNTIME
     // Clear the accumulated runtime
     clear_block_buffer_runtime();
   #endif
@@ -1689,6 +1867,9 @@ bool Planner::_buffer_steps(const xyze_long_t &target
     , const xyze_float_t &cart_dist_mm
   #endif
   , feedRate_t fr_mm_s, const uint8_t extruder, const float &millimeters
+  #if ENABLED(NATIVE_ARCS)
+    , const arc_piece_t * const arc
+  #endif
 ) {
 
   // If we are cleaning, do not accept queuing of movements
@@ -1707,6 +1888,9 @@ bool Planner::_buffer_steps(const xyze_long_t &target
       , cart_dist_mm
     #endif
     , fr_mm_s, extruder, millimeters
+    #if ENABLED(NATIVE_ARCS)
+      , arc
+    #endif
   )) {
     // Movement was not queued, probably because it was too short.
     //  Simply accept that as movement queued and done
@@ -1726,6 +1910,8 @@ bool Planner::_buffer_steps(const xyze_long_t &target
   // Move buffer head
   block_buffer_head = next_buffer_head;
 
+  TERN_(MOTION_BENCHMARK, MotionBenchmark::planner_blocks++);
+
   // Recalculate and optimize trapezoidal speed profiles
   recalculate();
 
@@ -1753,6 +1939,9 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     , const xyze_float_t &cart_dist_mm
   #endif
   , feedRate_t fr_mm_s, const uint8_t extruder, const float &millimeters/*=0.0*/
+  #if ENABLED(NATIVE_ARCS)
+    , const arc_piece_t * const arc/*=nullptr*/
+  #endif
 ) {
 
   const int32_t da = target.a - position.a,
@@ -1974,6 +2163,15 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
 
   block->step_event_count = _MAX(block->steps.a, block->steps.b, block->steps.c, esteps);
 
+  #if ENABLED(NATIVE_ARCS)
+    // Step events follow the circle, which is longer than either axis move
+    if (arc) {
+      block->flag = BLOCK_FLAG_ARC;
+      block->arc = arc->arc;
+      block->step_event_count = arc->step_event_count;
+    }
+  #endif
+
   // Bail if this is a zero-length block
   if (block->step_event_count < MIN_STEPS_PER_SEGMENT) return false;
 
@@ -2081,7 +2279,7 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   const uint8_t moves_queued = nonbusy_movesplanned();
 
   // Slow down when the buffer starts to empty, rather than wait at the corner for a buffer refill
-  #if EITHER(SLOWDOWN, HAS_SPI_LCD) || defined(XY_FREQUENCY_LIMIT)
+  #if ENABLED(SLOWDOWN) || HAS_BLOCK_BUFFER_RUNTIME || defined(XY_FREQUENCY_LIMIT)
     // Segment time im micro seconds
     int32_t segment_time_us = LROUND(1000000.0f / inverse_secs);
   #endif
@@ -2096,14 +2294,14 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
         // Buffer is draining so add extra time. The amount of time added increases if the buffer is still emptied more.
         const int32_t nst = segment_time_us + LROUND(2 * time_diff / moves_queued);
         inverse_secs = 1000000.0f / nst;
-        #if defined(XY_FREQUENCY_LIMIT) || HAS_SPI_LCD
+        #if defined(XY_FREQUENCY_LIMIT) || HAS_BLOCK_BUFFER_RUNTIME
           segment_time_us = nst;
         #endif
       }
     }
   #endif
 
-  #if HAS_SPI_LCD
+  #if HAS_BLOCK_BUFFER_RUNTIME
     // Protect the access to the position.
     const bool was_enabled = stepper.suspend();
 
@@ -2212,6 +2410,11 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     block->nominal_speed_sqr = block->nominal_speed_sqr * sq(speed_factor);
   }
 
+  #if ENABLED(NATIVE_ARCS)
+    // An arc starts out along the tangent, not the chord
+    if (arc) current_speed = arc->entry_dir * SQRT(block->nominal_speed_sqr);
+  #endif
+
   // Compute and limit the acceleration rate for the trapezoid generator.
   const float steps_per_mm = block->step_event_count * inverse_millimeters;
   uint32_t accel;
@@ -2261,9 +2464,10 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
           #if IS_KINEMATIC
             block->millimeters
           #else
-            SQRT(sq(target_float.x - position_float.x)
-               + sq(target_float.y - position_float.y)
-               + sq(target_float.z - position_float.z))
+            (TERN0(NATIVE_ARCS, arc) ? block->millimeters
+              : SQRT(sq(target_float.x - position_float.x)
+                   + sq(target_float.y - position_float.y)
+                   + sq(target_float.z - position_float.z)))
           #endif
         ;
 
@@ -2359,6 +2563,11 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
       #endif
     ;
 
+    #if ENABLED(NATIVE_ARCS)
+      // Arcs meet their neighbors along the tangent, scaled here like the chord
+      if (arc) unit_vec = arc->entry_dir * block->millimeters;
+    #endif
+
     /**
      * On CoreXY the length of the vector [A,B] is SQRT(2) times the length of the head movement vector [X,Y].
      * So taking Z and E into account, we cannot scale to a unit vector with "inverse_millimeters".
@@ -2489,7 +2698,14 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     else // Init entry speed to zero. Assume it starts from rest. Planner will correct this later.
       vmax_junction_sqr = 0;
 
-    prev_unit_vec = unit_vec;
+    #if ENABLED(NATIVE_ARCS)
+      if (arc) {
+        prev_unit_vec = arc->exit_dir;
+        if (esteps > 0) normalize_junction_vector(prev_unit_vec);
+      }
+      else
+    #endif
+        prev_unit_vec = unit_vec;
 
   #endif
 
@@ -2603,14 +2819,21 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   #endif // Classic Jerk Limiting
 
   // Max entry speed of this block equals the max exit speed of the previous block.
-  block->max_entry_speed_sqr = vmax_junction_sqr;
+  block->max_entry_speed_sqr = to_speed_sqr(vmax_junction_sqr);
 
   // Initialize block entry speed. Compute based on deceleration to user-defined MINIMUM_PLANNER_SPEED.
   const float v_allowable_sqr = max_allowable_speed_sqr(-block->acceleration, sq(float(MINIMUM_PLANNER_SPEED)), block->millimeters);
 
   // If we are trying to add a split block, start with the
   // max. allowed speed to avoid an interrupted first move.
-  block->entry_speed_sqr = !split_move ? sq(float(MINIMUM_PLANNER_SPEED)) : _MIN(vmax_junction_sqr, v_allowable_sqr);
+  block->entry_speed_sqr = to_speed_sqr(!split_move ? sq(float(MINIMUM_PLANNER_SPEED)) : _MIN(vmax_junction_sqr, v_allowable_sqr));
+
+  #if ENABLED(PLANNER_FIXED_POINT)
+    // Pre-scale the values used by the fixed-point planner kernels
+    block->accel_distance_sqr = to_speed_sqr(2 * block->acceleration * block->millimeters);
+    const float rate_per_speed = block->nominal_rate / SQRT(block->nominal_speed_sqr);
+    block->rate_per_speed = rate_per_speed < 65535.0f ? uint32_t(rate_per_speed * 65536.0f) : UINT32_MAX;
+  #endif
 
   // Initialize planner efficiency flags
   // Set flag if block will always reach maximum junction speed regardless of entry/exit speeds.
@@ -2624,6 +2847,9 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
 
   // Update previous path unit_vector and nominal speed
   previous_speed = current_speed;
+  #if ENABLED(NATIVE_ARCS)
+    if (arc) previous_speed = arc->exit_dir * SQRT(block->nominal_speed_sqr);
+  #endif
   previous_nominal_speed_sqr = block->nominal_speed_sqr;
 
   position = target;  // Update the position
@@ -2686,6 +2912,9 @@ bool Planner::buffer_segment(const float &a, const float &b, const float &c, con
     , const xyze_float_t &cart_dist_mm
   #endif
   , const feedRate_t &fr_mm_s, const uint8_t extruder, const float &millimeters/*=0.0*/
+  #if ENABLED(NATIVE_ARCS)
+    , const arc_piece_t * const arc/*=nullptr*/
+  #endif
 ) {
 
   // If we are cleaning, do not accept queuing of movements
@@ -2757,7 +2986,11 @@ bool Planner::buffer_segment(const float &a, const float &b, const float &c, con
       #if HAS_DIST_MM_ARG
         , cart_dist_mm
       #endif
-      , fr_mm_s, extruder, millimeters)
+      , fr_mm_s, extruder, millimeters
+      #if ENABLED(NATIVE_ARCS)
+        , arc
+      #endif
+    )
   ) return false;
 
   stepper.wake_up();
@@ -2826,6 +3059,134 @@ bool Planner::buffer_line(const float &rx, const float &ry, const float &rz, con
   #endif
 } // buffer_line()
 
+#if ENABLED(NATIVE_ARCS)
+
+  /**
+   * The rounded distance y >= 0 with y² - y < v <= y² + y,
+   * as the stepper keeps it for the slow axis of an arc block.
+   */
+  static int32_t arc_root(const int64_t v) {
+    if (v <= 0) return 0;
+    int64_t y = SQRT(float(v));
+    while (y > 0 && y * y - y >= v) y--;
+    while (y * y + y < v) y++;
+    return y;
+  }
+
+  /**
+   * Add an XY arc as one block per octant, so X and Y each keep one
+   * direction through the block and one axis never moves slower than
+   * the other. Octant boundaries within a few steps of the ends of the
+   * arc are skipped. Each block ends on the circle through the current
+   * position, which is kept in whole steps around the nearest step to
+   * the center. A final line corrects for any rounding at the target.
+   */
+  bool Planner::buffer_arc(const xyze_pos_t &cart, const xy_pos_t &center, const float angular_travel, feedRate_t fr_mm_s, const uint8_t extruder) {
+
+    // Only equal X and Y resolution keeps the circle round
+    const float spm = settings.axis_steps_per_mm[X_AXIS];
+    if (leveling_active || spm != settings.axis_steps_per_mm[Y_AXIS]) return false;
+
+    const xy_long_t c = { LROUND(center.x * spm), LROUND(center.y * spm) },
+                    t = { LROUND(cart.x * spm) - c.x, LROUND(cart.y * spm) - c.y };
+    const int64_t R2 = sq(int64_t(position.x - c.x)) + sq(int64_t(position.y - c.y));
+    const float r = SQRT(float(R2)), total = ABS(angular_travel);
+    if (r < 8 * (MIN_STEPS_PER_SEGMENT)) return false;
+
+    // A step event may only step Z and E once, so they must move less than X and Y
+    const int32_t dz_steps = LROUND(cart.z * settings.axis_steps_per_mm[Z_AXIS]) - position.z;
+    #if EXTRUDERS
+      const float de_steps = (LROUND(cart.e * settings.axis_steps_per_mm[E_AXIS_N(extruder)]) - position.e) * e_factor[extruder];
+    #else
+      constexpr float de_steps = 0;
+    #endif
+    if (2 * _MAX(float(ABS(dz_steps)), ABS(de_steps)) > r * total) return false;
+
+    // Limit the speed to the centripetal acceleration and the XY feedrates
+    NOMORE(fr_mm_s, _MIN(SQRT((de_steps ? settings.acceleration : settings.travel_acceleration) * r / spm),
+                         settings.max_feedrate_mm_s[X_AXIS], settings.max_feedrate_mm_s[Y_AXIS]));
+
+    // The largest coordinate on the circle not past a diagonal
+    int32_t diag = r * float(M_SQRT1_2) + 1;
+    while (diag > arc_root(R2 - sq(int64_t(diag)))) diag--;
+
+    const float q = RADIANS(45), min_angle = 2.0f * (MIN_STEPS_PER_SEGMENT) / r,
+                phi0 = ATAN2(float(position.y - c.y), float(position.x - c.x)),
+                start_z = current_position.z, dz = cart.z - start_z,
+                start_e = current_position.e, de = cart.e - start_e;
+    const int8_t adir = angular_travel < 0 ? -1 : 1;
+
+    float done = 0,                         // Angle turned so far
+          next = adir > 0 ? (FLOOR(phi0 / q) + 1) * q - phi0 : phi0 - (CEIL(phi0 / q) - 1) * q; // Angle to the next boundary
+
+    arc_piece_t piece;
+    block_arc_t &a = piece.arc;
+
+    while (done < total) {
+      while (next < done + min_angle) next += q;
+      const bool last = next > total - min_angle;
+      const float end = last ? total : next,
+                  phi_mid = phi0 + adir * 0.5f * (done + end),
+                  phi_end = phi0 + adir * end;
+
+      // The fast axis is the one nearer the center
+      const bool x_fast = ABS(cos(phi_mid)) < ABS(sin(phi_mid));
+      const AxisEnum fa = x_fast ? X_AXIS : Y_AXIS, sa = x_fast ? Y_AXIS : X_AXIS;
+      const float cos_end = cos(phi_end), sin_end = sin(phi_end);
+
+      // End at the target, on a diagonal, or on an axis
+      int32_t f_end;
+      if (last)
+        f_end = constrain(t[fa], -int32_t(r), int32_t(r));
+      else if (LROUND(phi_end / q) & 1)
+        f_end = (x_fast ? cos_end : sin_end) < 0 ? -diag : diag;
+      else
+        f_end = 0;
+
+      const xy_long_t p = { position.x - c.x, position.y - c.y };
+      xy_long_t e;
+      e[fa] = f_end;
+      a.y_end = arc_root(R2 - sq(int64_t(f_end)));
+      e[sa] = (x_fast ? sin_end : cos_end) < 0 ? -a.y_end : a.y_end;
+
+      // The circle for the stepper
+      const int64_t v = R2 - sq(int64_t(p[fa]));
+      a.f = p[fa];
+      a.f_end = f_end;
+      a.y = arc_root(v);
+      a.y_start = ABS(p[sa]);
+      a.lo = v - (sq(int64_t(a.y)) - a.y);
+      a.hi = sq(int64_t(a.y)) + a.y - v;
+      a.r = LROUND(r);
+      a.ydir = a.y_end < a.y_start ? -1 : 1;
+      a.fast = fa;
+
+      const float angle = end - done,
+                  flat_mm = r * angle / spm,
+                  piece_dz = dz * angle / total,
+                  mm = piece_dz ? HYPOT(flat_mm, piece_dz) : flat_mm,
+                  xy_per_mm = adir * flat_mm / (mm * r),
+                  z_per_mm = piece_dz / mm, e_per_mm = de * angle / total / mm;
+
+      piece.step_event_count = _MAX(uint32_t(LROUND(r * angle)), uint32_t(ABS(e.x - p.x)), uint32_t(ABS(e.y - p.y)));
+      piece.entry_dir.set(-p.y * xy_per_mm, p.x * xy_per_mm, z_per_mm, e_per_mm);
+      piece.exit_dir.set(-e.y * xy_per_mm, e.x * xy_per_mm, z_per_mm, e_per_mm);
+
+      abce_pos_t machine = { (c.x + e.x) / spm, (c.y + e.y) / spm, start_z + dz * end / total, start_e + de * end / total };
+      TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine, false));
+
+      if (!buffer_segment(machine, fr_mm_s, extruder, mm, &piece)) return true;
+
+      done = end;
+    }
+
+    // Correct for rounding at the target
+    buffer_line(cart, fr_mm_s, extruder);
+    return true;
+  }
+
+#endif // NATIVE_ARCS
+
 #if ENABLED(DIRECT_STEPPING)
 
   void Planner::buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps) {
@@ -3029,7 +3390,7 @@ void Planner::set_max_jerk(const AxisEnum axis, float targetValue) {
   #endif
 }
 
-#if HAS_SPI_LCD
+#if HAS_BLOCK_BUFFER_RUNTIME
 
   uint16_t Planner::block_buffer_runtime() {
     #ifdef __AVR__
@@ -102,6 +102,16 @@ enum BlockFlagBit : char {
   #if ENABLED(DIRECT_STEPPING)
     , BLOCK_BIT_IS_PAGE
   #endif
+
+  // The stepper start state is prepared
+  #if ENABLED(STEPPER_BLOCK_PREP)
+    , BLOCK_BIT_PREPARED
+  #endif
+
+  // X and Y follow a circle (see block_arc_t)
+  #if ENABLED(NATIVE_ARCS)
+    , BLOCK_BIT_ARC
+  #endif
 };
 
 enum BlockFlag : char {
@@ -112,6 +122,12 @@ enum BlockFlag : char {
   #if ENABLED(DIRECT_STEPPING)
     , BLOCK_FLAG_IS_PAGE            = _BV(BLOCK_BIT_IS_PAGE)
   #endif
+  #if ENABLED(STEPPER_BLOCK_PREP)
+    , BLOCK_FLAG_PREPARED           = _BV(BLOCK_BIT_PREPARED)
+  #endif
+  #if ENABLED(NATIVE_ARCS)
+    , BLOCK_FLAG_ARC                = _BV(BLOCK_BIT_ARC)
+  #endif
 };
 
 #if ENABLED(LASER_POWER_INLINE)
@@ -138,6 +154,52 @@ enum BlockFlag : char {
 
 #endif
 
+#if ENABLED(NATIVE_ARCS)
+
+  /**
+   * The circle traced by an arc block, in steps relative to its center.
+   * Within one octant the "fast" axis never moves slower than the other
+   * (slow) axis, whose distance from the center follows from the fast
+   * coordinate f as the y with y² - y < r² - f² <= y² + y. The stepper
+   * keeps that rounding up to date from the margins 'lo' and 'hi' as f
+   * changes, so no roots are taken while stepping.
+   */
+  typedef struct {
+    int32_t f, f_end,                       // Fast axis coordinate at the start and end of the block
+            y,                              // Slow axis distance on the circle at coordinate 'f'
+            y_start, y_end,                 // Slow axis distance at the start and end of the block
+            lo, hi;                         // Margins (r² - f²) - (y² - y) > 0 and (y² + y) - (r² - f²) >= 0
+    uint32_t r;                             // Radius in steps
+    int8_t ydir;                            // +1 if the slow axis distance grows, -1 if it shrinks
+    uint8_t fast;                           // X_AXIS or Y_AXIS
+  } block_arc_t;
+
+  // One octant of an arc, passed by buffer_arc() down to _populate_block()
+  typedef struct {
+    block_arc_t arc;
+    uint32_t step_event_count;              // Steps along the circle
+    xyze_float_t entry_dir, exit_dir;       // Direction per mm of travel at the start and end
+  } arc_piece_t;
+
+#endif
+
+#define MINIMAL_STEP_RATE 120 // (steps/s) Lowest trapezoid rate, so the step timer can't overflow
+
+#if ENABLED(PLANNER_FIXED_POINT)
+  // Speeds squared in (mm/sec)^2 as unsigned Q24.8, for speeds up to 4096mm/s
+  typedef uint32_t speed_sqr_t;
+  #define SPEED_SQR_FRACT 8
+  #define SPEED_SQR_MAX   UINT32_MAX
+  FORCE_INLINE speed_sqr_t to_speed_sqr(const float v) {
+    return v <= 0 ? 0 : v >= float(SPEED_SQR_MAX >> (SPEED_SQR_FRACT)) ? SPEED_SQR_MAX : speed_sqr_t(v * (1UL << (SPEED_SQR_FRACT)));
+  }
+  FORCE_INLINE float from_speed_sqr(const speed_sqr_t v) { return v * (1.0f / (1UL << (SPEED_SQR_FRACT))); }
+#else
+  typedef float speed_sqr_t;
+  FORCE_INLINE float to_speed_sqr(const float v) { return v; }
+  FORCE_INLINE float from_speed_sqr(const float v) { return v; }
+#endif
+
 /**
  * struct block_t
  *
@@ -153,10 +215,15 @@ typedef struct block_t {
 
   // Fields used by the motion planner to manage acceleration
   float nominal_speed_sqr,                  // The nominal speed for this block in (mm/sec)^2
-        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
-        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
         millimeters,                        // The total travel of this block in mm
         acceleration;                       // acceleration mm/sec^2
+  speed_sqr_t entry_speed_sqr,              // Entry speed at previous-current junction in (mm/sec)^2
+              max_entry_speed_sqr;          // Maximum allowable junction entry speed in (mm/sec)^2
+
+  #if ENABLED(PLANNER_FIXED_POINT)
+    speed_sqr_t accel_distance_sqr;         // Speed squared gained by accelerating over the whole block (2 * a * d)
+    uint32_t rate_per_speed;                // Step rate per mm/sec of speed, as Q16.16
+  #endif
 
   union {
     abce_ulong_t steps;                     // Step count along each axis
@@ -206,6 +273,10 @@ typedef struct block_t {
     page_idx_t page_idx;                    // Page index used for direct stepping
   #endif
 
+  #if ENABLED(NATIVE_ARCS)
+    block_arc_t arc;                        // The circle for X and Y if BLOCK_BIT_ARC is set
+  #endif
+
   #if HAS_CUTTER
     cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
   #endif
@@ -218,7 +289,7 @@ typedef struct block_t {
     uint8_t valve_pressure, e_to_p_pressure;
   #endif
 
-  #if HAS_SPI_LCD
+  #if HAS_BLOCK_BUFFER_RUNTIME
     uint32_t segment_time_us;
   #endif
 
@@ -238,6 +309,16 @@ typedef struct block_t {
 
 #define BLOCK_MOD(n) ((n)&(BLOCK_BUFFER_SIZE-1))
 
+#if ENABLED(PLANNER_RECALC_STATS)
+  typedef struct {
+    uint32_t recalculations,    // Calls to recalculate(), one per added block
+             reverse_kernels,   // Junctions visited by the reverse pass
+             forward_kernels,   // Junctions visited by the forward pass
+             trapezoid_kernels, // Blocks visited by the trapezoid pass
+             trapezoids;        // Trapezoids recalculated
+  } planner_recalc_stats_t;
+#endif
+
 #if ENABLED(LASER_POWER_INLINE)
   typedef struct {
     /**
@@ -311,6 +392,13 @@ class Planner {
     static uint16_t cleaning_buffer_counter;        // A counter to disable queuing of blocks
     static uint8_t delay_before_delivering;         // This counter delays delivery of blocks when queue becomes empty to allow the opportunity of merging blocks
 
+    #if ENABLED(INCREMENTAL_PLANNER)
+      static uint8_t block_buffer_dirty;            // Index of the last block left unchanged by the reverse pass
+    #endif
+
+    #if ENABLED(PLANNER_RECALC_STATS)
+      static planner_recalc_stats_t recalc_stats;   // Planner work counters
+    #endif
 
     #if ENABLED(DISTINCT_E_FACTORS)
       static uint8_t last_extruder;                 // Respond to extruder change
@@ -438,7 +526,7 @@ class Planner {
       static uint8_t g_uc_extruder_last_move[EXTRUDERS];
     #endif
 
-    #if HAS_SPI_LCD
+    #if HAS_BLOCK_BUFFER_RUNTIME
       volatile static uint32_t block_buffer_runtime_us; // Theoretical block buffer runtime in µs
     #endif
 
@@ -662,6 +750,7 @@ class Planner {
      *  fr_mm_s     - (target) speed of the move
      *  extruder    - target extruder
      *  millimeters - the length of the movement, if known
+     *  arc         - the arc octant to trace, if any (NATIVE_ARCS)
      *
      * Returns true if movement was buffered, false otherwise
      */
@@ -673,6 +762,9 @@ class Planner {
         , const xyze_float_t &cart_dist_mm
       #endif
       , feedRate_t fr_mm_s, const uint8_t extruder, const float &millimeters=0.0
+      #if ENABLED(NATIVE_ARCS)
+        , const arc_piece_t * const arc=nullptr
+      #endif
     );
 
     /**
@@ -684,6 +776,7 @@ class Planner {
      *  fr_mm_s     - (target) speed of the move
      *  extruder    - target extruder
      *  millimeters - the length of the movement, if known
+     *  arc         - the arc octant to trace, if any (NATIVE_ARCS)
      *
      * Returns true is movement is acceptable, false otherwise
      */
@@ -696,6 +789,9 @@ class Planner {
         , const xyze_float_t &cart_dist_mm
       #endif
       , feedRate_t fr_mm_s, const uint8_t extruder, const float &millimeters=0.0
+      #if ENABLED(NATIVE_ARCS)
+        , const arc_piece_t * const arc=nullptr
+      #endif
     );
 
     /**
@@ -722,12 +818,16 @@ class Planner {
      *  fr_mm_s     - (target) speed of the move
      *  extruder    - target extruder
      *  millimeters - the length of the movement, if known
+     *  arc         - the arc octant to trace, if any (NATIVE_ARCS)
      */
     static bool buffer_segment(const float &a, const float &b, const float &c, const float &e
       #if HAS_DIST_MM_ARG
         , const xyze_float_t &cart_dist_mm
       #endif
       , const feedRate_t &fr_mm_s, const uint8_t extruder, const float &millimeters=0.0
+      #if ENABLED(NATIVE_ARCS)
+        , const arc_piece_t * const arc=nullptr
+      #endif
     );
 
     FORCE_INLINE static bool buffer_segment(abce_pos_t &abce
@@ -735,12 +835,19 @@ class Planner {
         , const xyze_float_t &cart_dist_mm
       #endif
       , const feedRate_t &fr_mm_s, const uint8_t extruder, const float &millimeters=0.0
+      #if ENABLED(NATIVE_ARCS)
+        , const arc_piece_t * const arc=nullptr
+      #endif
     ) {
       return buffer_segment(abce.a, abce.b, abce.c, abce.e
         #if HAS_DIST_MM_ARG
           , cart_dist_mm
         #endif
-        , fr_mm_s, extruder, millimeters);
+        , fr_mm_s, extruder, millimeters
+        #if ENABLED(NATIVE_ARCS)
+          , arc
+        #endif
+      );
     }
 
   public:
@@ -778,6 +885,21 @@ class Planner {
       static void buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps);
     #endif
 
+    #if ENABLED(NATIVE_ARCS)
+      /**
+       * Add an XY arc to the buffer as one block per octant that the
+       * stepper traces along the circle. Returns false, having buffered
+       * nothing, if the arc must be segmented instead.
+       *
+       *  cart           - target position in mm
+       *  center         - center of the arc in mm
+       *  angular_travel - angle to turn, counter-clockwise positive
+       *  fr_mm_s        - (target) speed of the move (mm/s)
+       *  extruder       - target extruder
+       */
+      static bool buffer_arc(const xyze_pos_t &cart, const xy_pos_t &center, const float angular_travel, feedRate_t fr_mm_s, const uint8_t extruder);
+    #endif
+
     /**
      * Set the planner.position and individual stepper positions.
      * Used by G92, G28, G29, and other procedures.
@@ -871,7 +993,7 @@ class Planner {
         block_buffer_tail = next_block_index(block_buffer_tail);
     }
 
-    #if HAS_SPI_LCD
+    #if HAS_BLOCK_BUFFER_RUNTIME
       static uint16_t block_buffer_runtime();
       static void clear_block_buffer_runtime();
     #endif
@@ -894,6 +1016,10 @@ class Planner {
 
   private:
 
+    #if ENABLED(PLANNER_FIXED_POINT) && defined(__PLAT_LINUX__)
+      friend class SelfTest;  // Checks the fixed-point kernels against the float math
+    #endif
+
     /**
      * Get the index of the next / previous block in the ring buffer
      */
@@ -940,9 +1066,51 @@ class Planner {
       }
     #endif
 
-    static void calculate_trapezoid_for_block(block_t* const block, const float &entry_factor, const float &exit_factor);
+    /**
+     * Calculate the maximum entry speed squared for a block, in order
+     * to leave it at 'exit_speed_sqr' decelerating over its full length.
+     */
+    FORCE_INLINE static speed_sqr_t allowable_entry_speed_sqr(const block_t * const block, const speed_sqr_t exit_speed_sqr) {
+      #if ENABLED(PLANNER_FIXED_POINT)
+        const speed_sqr_t v = exit_speed_sqr + block->accel_distance_sqr;
+        return v < exit_speed_sqr ? SPEED_SQR_MAX : v;  // Saturate on overflow
+      #else
+        return max_allowable_speed_sqr(-block->acceleration, exit_speed_sqr, block->millimeters);
+      #endif
+    }
+
+    #if ENABLED(PLANNER_FIXED_POINT)
+
+      static constexpr speed_sqr_t min_planner_speed_sqr = speed_sqr_t(sq(float(MINIMUM_PLANNER_SPEED)) * (1UL << (SPEED_SQR_FRACT)));
+
+      // Integer square root, rounded down
+      static uint32_t isqrt(uint32_t v);
+
+      // Step rate for a speed squared along the block, rounded up
+      static uint32_t speed_sqr_to_rate(const block_t * const block, const speed_sqr_t speed_sqr);
+
+      /**
+       * Integer version of estimate_acceleration_distance() for a non-negative
+       * 'accel', rounded up or down. Step rates are exact, so the result
+       * is at least as accurate as the float version. All math is 32-bit,
+       * with rates over 65535 steps/s falling back to float.
+       */
+      static uint32_t acceleration_steps(const uint32_t initial_rate, const uint32_t target_rate, const uint32_t accel, const bool round_up);
+
+      // Integer version of intersection_distance(), rounded up and limited to 0..steps
+      static uint32_t intersection_steps(const uint32_t initial_rate, const uint32_t final_rate, const uint32_t accel, const uint32_t steps);
+
+      static void calculate_trapezoid_for_block(block_t* const block, const speed_sqr_t entry_speed_sqr, const speed_sqr_t exit_speed_sqr);
+
+    #else
+
+      static constexpr float min_planner_speed_sqr = sq(float(MINIMUM_PLANNER_SPEED));
+
+      static void calculate_trapezoid_for_block(block_t* const block, const float &entry_factor, const float &exit_factor);
+
+    #endif
 
-    static void reverse_pass_kernel(block_t* const current, const block_t * const next);
+    static bool reverse_pass_kernel(block_t* const current, const block_t * const next);
     static void forward_pass_kernel(const block_t * const previous, block_t* const current, uint8_t block_index);
 
     static void reverse_pass();
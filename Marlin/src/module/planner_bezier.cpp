@@ -31,6 +31,7 @@
 
 #if ENABLED(BEZIER_CURVE_SUPPORT)
 
+#include "planner_bezier.h"
 #include "planner.h"
 #include "motion.h"
 #include "temperature.h"
@@ -38,168 +39,148 @@
 #include "../MarlinCore.h"
 #include "../gcode/queue.h"
 
-// See the meaning in the documentation of cubic_b_spline().
-#define MIN_STEP 0.002f
-#define MAX_STEP 0.1f
-#define SIGMA 0.1f
+// Half the tolerance is for flattening the curve and half for merging lines
+#define SIGMA (0.5f * (BEZIER_TOLERANCE))
+
+// Most points to hold back while merging, and most lines to split the curve into
+#define MAX_MERGE 16
+#define MAX_SEGMENTS 1000
 
 // Compute the linear interpolation between two real numbers.
 static inline float interp(const float &a, const float &b, const float &t) { return (1 - t) * a + t * b; }
 
 /**
- * Compute a Bézier curve using the De Casteljau's algorithm (see
- * https://en.wikipedia.org/wiki/De_Casteljau%27s_algorithm), which is
- * easy to code and has good numerical stability (very important,
- * since Arudino works with limited precision real numbers).
+ * Is every held back point within SIGMA of the line from 0 to 'end',
+ * and not before or beyond its ends?
  */
-static inline float eval_bezier(const float &a, const float &b, const float &c, const float &d, const float &t) {
-  const float iab = interp(a, b, t),
-              ibc = interp(b, c, t),
-              icd = interp(c, d, t),
-              iabc = interp(iab, ibc, t),
-              ibcd = interp(ibc, icd, t);
-  return interp(iabc, ibcd, t);
+static bool all_near_line(const xy_pos_t (&held)[MAX_MERGE], const uint8_t count, const xy_pos_t &end) {
+  const float len_sq = sq(end.x) + sq(end.y), limit = sq(float(SIGMA)) * len_sq;
+  LOOP_L_N(i, count) {
+    const xy_pos_t &p = held[i];
+    const float dot = p.x * end.x + p.y * end.y;
+    if (dot < 0 || dot > len_sq || sq(end.x * p.y - end.y * p.x) > limit) return false;
+  }
+  return true;
 }
 
 /**
- * We approximate Euclidean distance with the sum of the coordinates
- * offset (so-called "norm 1"), which is quicker to compute.
- */
-static inline float dist1(const float &x1, const float &y1, const float &x2, const float &y2) { return ABS(x1 - x2) + ABS(y1 - y2); }
-
-/**
- * The algorithm for computing the step is loosely based on the one in Kig
- * (See https://sources.debian.net/src/kig/4:15.08.3-1/misc/kigpainter.cpp/#L759)
- * However, we do not use the stack.
- *
- * The algorithm goes as it follows: the parameters t runs from 0.0 to
- * 1.0 describing the curve, which is evaluated by eval_bezier(). At
- * each iteration we have to choose a step, i.e., the increment of the
- * t variable. By default the step of the previous iteration is taken,
- * and then it is enlarged or reduced depending on how straight the
- * curve locally is. The step is always clamped between MIN_STEP/2 and
- * 2*MAX_STEP. MAX_STEP is taken at the first iteration.
+ * The curve is cut into n lines of equal parameter step h = 1 / n.
+ * A chord strays from its piece of the curve by at most h² / 8 times
+ * the largest second derivative, which for a cubic Bézier is 6 times
+ * the longer of its two second differences (Wang's formula), so n
+ * follows directly from the tolerance.
  *
- * For some t, the step value is considered acceptable if the curve in
- * the interval [t, t+step] is sufficiently straight, i.e.,
- * sufficiently close to linear interpolation. In practice the
- * following test is performed: the distance between eval_bezier(...,
- * t+step/2) is evaluated and compared with 0.5*(eval_bezier(...,
- * t)+eval_bezier(..., t+step)). If it is smaller than SIGMA, then the
- * step value is considered acceptable, otherwise it is not. The code
- * seeks to find the larger step value which is considered acceptable.
+ * The points are found by forward differencing the cubic polynomial,
+ * taking only additions per point. They're worked out relative to the
+ * start, where floats have the most precision, and the last point is
+ * the target itself.
  *
- * At every iteration the recorded step value is considered and then
- * iteratively halved until it becomes acceptable. If it was already
- * acceptable in the beginning (i.e., no halving were done), then
- * maybe it was necessary to enlarge it; then it is iteratively
- * doubled while it remains acceptable. The last acceptable value
- * found is taken, provided that it is between MIN_STEP and MAX_STEP
- * and does not bring t over 1.0.
+ * Runs of lines that stay close to one straight line are merged before
+ * reaching the planner. A point is held back while every point since
+ * the last line sent is within SIGMA of the line to the newest point.
  *
- * Caveat: this algorithm is not perfect, since it can happen that a
- * step is considered acceptable even when the curve is not linear at
- * all in the interval [t, t+step] (but its mid point coincides "by
- * chance" with the midpoint according to the parametrization). This
- * kind of glitches can be eliminated with proper first derivative
- * estimates; however, given the improbability of such configurations,
- * the mitigation offered by MIN_STEP and the small computational
- * power available on Arduino, I think it is not wise to implement it.
+ * Both steps stray by no more than SIGMA, so the path sent to the
+ * planner stays within BEZIER_TOLERANCE of the true curve.
  */
-void cubic_b_spline(
-  const xyze_pos_t &position,       // current position
-  const xyze_pos_t &target,         // target position
+bool bezier_flatten(
+  const xy_pos_t &end,              // end point relative to the start
   const xy_pos_t (&offsets)[2],     // a pair of offsets
-  const feedRate_t &scaled_fr_mm_s, // mm/s scaled by feedrate %
-  const uint8_t extruder
+  const bezier_line_t line,         // called with the end of each line
+  void * const arg
 ) {
-  // Absolute first and second control points are recovered.
-  const xy_pos_t first = position + offsets[0], second = target + offsets[1];
+  // Control points relative to the start
+  const xy_pos_t p1 = offsets[0],
+                 p3 = end,
+                 p2 = p3 + offsets[1];
+
+  // Number of lines needed to stay within SIGMA
+  const xy_pos_t dd1 = p2 - p1 * 2, dd2 = p1 - p2 * 2 + p3;
+  const float dd = SQRT(_MAX(sq(dd1.x) + sq(dd1.y), sq(dd2.x) + sq(dd2.y)));
+  const uint16_t segments = constrain(CEIL(SQRT(6 * dd / (8 * (SIGMA)))), 1, MAX_SEGMENTS);
+
+  // B(t) = a t³ + b t² + c t, and its forward differences for the step h
+  const float h = 1.0f / segments;
+  const xy_pos_t a = p3 - p2 * 3 + p1 * 3,
+                 b = p2 * 3 - p1 * 6,
+                 c = p1 * 3;
+  xy_pos_t d1 = (a * h + b) * h * h + c * h,
+           d2 = (a * (6 * h) + b * 2) * h * h;
+  const xy_pos_t d3 = a * (6 * h * h * h);
+
+  xy_pos_t pos{0}, last_pos{0},             // The newest point, and the end of the last line sent
+           held[MAX_MERGE];                 // Points since then, relative to 'last_pos'
+  uint8_t held_count = 0;
+  float held_t = 0;                         // Parameter of the newest held back point
+
+  for (uint16_t i = 1; i <= segments; i++) {
+
+    if (i < segments) {
+      pos += d1;
+      d1 += d2;
+      d2 += d3;
+    }
+    else
+      pos = p3;
+
+    // Send the held back line if the new point can't extend it
+    if (held_count) {
+      const xy_pos_t prev = held[held_count - 1];
+      if (held_count == MAX_MERGE || !all_near_line(held, held_count, pos - last_pos)) {
+        if (!line(last_pos + prev, held_t, arg)) return false;
+        last_pos += prev;
+        held_count = 0;
+      }
+    }
 
-  xyze_pos_t bez_target;
-  bez_target.set(position.x, position.y);
-  float step = MAX_STEP;
+    held[held_count++] = pos - last_pos;
+    held_t = i * h;
+  }
 
-  millis_t next_idle_ms = millis() + 200UL;
+  // The last point is the target
+  return line(p3, 1, arg);
+}
 
-  for (float t = 0; t < 1;) {
+typedef struct {
+  const xyze_pos_t &position, &target;
+  const feedRate_t &scaled_fr_mm_s;
+  millis_t next_idle_ms;
+} spline_move_t;
+
+// Buffer a line to a point along the curve
+static bool buffer_spline_line(const xy_pos_t &to, const float t, void * const arg) {
+  spline_move_t &move = *(spline_move_t*)arg;
+
+  thermalManager.manage_heater();
+  millis_t now = millis();
+  if (ELAPSED(now, move.next_idle_ms)) {
+    move.next_idle_ms = now + 200UL;
+    idle();
+  }
 
-    thermalManager.manage_heater();
-    millis_t now = millis();
-    if (ELAPSED(now, next_idle_ms)) {
-      next_idle_ms = now + 200UL;
-      idle();
-    }
+  xyze_pos_t new_bez = {
+    move.position.x + to.x, move.position.y + to.y,
+    interp(move.position.z, move.target.z, t),    // FIXME. These two are wrong, since the parameter t is
+    interp(move.position.e, move.target.e, t)     // not linear in the distance.
+  };
 
-    // First try to reduce the step in order to make it sufficiently
-    // close to a linear interpolation.
-    bool did_reduce = false;
-    float new_t = t + step;
-    NOMORE(new_t, 1);
-    float new_pos0 = eval_bezier(position.x, first.x, second.x, target.x, new_t),
-          new_pos1 = eval_bezier(position.y, first.y, second.y, target.y, new_t);
-    for (;;) {
-      if (new_t - t < (MIN_STEP)) break;
-      const float candidate_t = 0.5f * (t + new_t),
-                  candidate_pos0 = eval_bezier(position.x, first.x, second.x, target.x, candidate_t),
-                  candidate_pos1 = eval_bezier(position.y, first.y, second.y, target.y, candidate_t),
-                  interp_pos0 = 0.5f * (bez_target.x + new_pos0),
-                  interp_pos1 = 0.5f * (bez_target.y + new_pos1);
-      if (dist1(candidate_pos0, candidate_pos1, interp_pos0, interp_pos1) <= (SIGMA)) break;
-      new_t = candidate_t;
-      new_pos0 = candidate_pos0;
-      new_pos1 = candidate_pos1;
-      did_reduce = true;
-    }
+  apply_motion_limits(new_bez);
 
-    // If we did not reduce the step, maybe we should enlarge it.
-    if (!did_reduce) for (;;) {
-      if (new_t - t > MAX_STEP) break;
-      const float candidate_t = t + 2 * (new_t - t);
-      if (candidate_t >= 1) break;
-      const float candidate_pos0 = eval_bezier(position.x, first.x, second.x, target.x, candidate_t),
-                  candidate_pos1 = eval_bezier(position.y, first.y, second.y, target.y, candidate_t),
-                  interp_pos0 = 0.5f * (bez_target.x + candidate_pos0),
-                  interp_pos1 = 0.5f * (bez_target.y + candidate_pos1);
-      if (dist1(new_pos0, new_pos1, interp_pos0, interp_pos1) > (SIGMA)) break;
-      new_t = candidate_t;
-      new_pos0 = candidate_pos0;
-      new_pos1 = candidate_pos1;
-    }
+  #if HAS_LEVELING && !PLANNER_LEVELING
+    planner.apply_leveling(new_bez);
+  #endif
 
-    // Check some postcondition; they are disabled in the actual
-    // Marlin build, but if you test the same code on a computer you
-    // may want to check they are respect.
-    /*
-      assert(new_t <= 1.0);
-      if (new_t < 1.0) {
-        assert(new_t - t >= (MIN_STEP) / 2.0);
-        assert(new_t - t <= (MAX_STEP) * 2.0);
-      }
-    */
-
-    step = new_t - t;
-    t = new_t;
-
-    // Compute and send new position
-    xyze_pos_t new_bez = {
-      new_pos0, new_pos1,
-      interp(position.z, target.z, t),   // FIXME. These two are wrong, since the parameter t is
-      interp(position.e, target.e, t)    // not linear in the distance.
-    };
-    apply_motion_limits(new_bez);
-    bez_target = new_bez;
-
-    #if HAS_LEVELING && !PLANNER_LEVELING
-      xyze_pos_t pos = bez_target;
-      planner.apply_leveling(pos);
-    #else
-      const xyze_pos_t &pos = bez_target;
-    #endif
-
-    if (!planner.buffer_line(pos, scaled_fr_mm_s, active_extruder, step))
-      break;
-  }
+  return planner.buffer_line(new_bez, move.scaled_fr_mm_s, active_extruder);
+}
+
+void cubic_b_spline(
+  const xyze_pos_t &position,       // current position
+  const xyze_pos_t &target,         // target position
+  const xy_pos_t (&offsets)[2],     // a pair of offsets
+  const feedRate_t &scaled_fr_mm_s, // mm/s scaled by feedrate %
+  const uint8_t extruder
+) {
+  spline_move_t move = { position, target, scaled_fr_mm_s, millis() + 200UL };
+  bezier_flatten(xy_pos_t(target) - xy_pos_t(position), offsets, buffer_spline_line, &move);
 }
 
 #endif // BEZIER_CURVE_SUPPORT
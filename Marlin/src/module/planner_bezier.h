@@ -30,6 +30,10 @@
 
 #include "../core/types.h"
 
+#ifndef BEZIER_TOLERANCE
+  #define BEZIER_TOLERANCE 0.02
+#endif
+
 void cubic_b_spline(
   const xyze_pos_t &position,       // current position
   const xyze_pos_t &target,         // target position
@@ -37,3 +41,17 @@ void cubic_b_spline(
   const feedRate_t &scaled_fr_mm_s, // mm/s scaled by feedrate %
   const uint8_t extruder
 );
+
+/**
+ * Flatten a Bézier curve into lines within BEZIER_TOLERANCE, calling 'line'
+ * with the end of each line relative to the start, and its curve parameter.
+ * Stop and return false as soon as 'line' returns false.
+ */
+typedef bool (*bezier_line_t)(const xy_pos_t &to, const float t, void * const arg);
+
+bool bezier_flatten(
+  const xy_pos_t &end,              // end point relative to the start
+  const xy_pos_t (&offsets)[2],     // a pair of offsets
+  const bezier_line_t line,         // called with the end of each line
+  void * const arg
+);
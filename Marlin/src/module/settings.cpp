@@ -546,9 +546,296 @@ void MarlinSettings::postprocess() {
                                   int eeprom_index = EEPROM_OFFSET
   #define EEPROM_FINISH()         persistentStore.access_finish()
   #define EEPROM_SKIP(VAR)        (eeprom_index += sizeof(VAR))
-  #define EEPROM_WRITE(VAR)       do{ persistentStore.write_data(eeprom_index, (uint8_t*)&VAR, sizeof(VAR), &working_crc);              }while(0)
-  #define EEPROM_READ(VAR)        do{ persistentStore.read_data(eeprom_index, (uint8_t*)&VAR, sizeof(VAR), &working_crc, !validating);  }while(0)
-  #define EEPROM_READ_ALWAYS(VAR) do{ persistentStore.read_data(eeprom_index, (uint8_t*)&VAR, sizeof(VAR), &working_crc);               }while(0)
+
+  #if ENABLED(EEPROM_STAGED_WRITE)
+
+    /**
+     * Fields are copied to and from a RAM image of the stored settings.
+     * M501 reads the whole image at once and M500 writes back only the
+     * blocks that changed. Either one takes a single CRC over the image.
+     */
+    #ifndef EEPROM_STAGE_BLOCK
+      #define EEPROM_STAGE_BLOCK 16
+    #endif
+
+    static uint8_t eeprom_image[sizeof(SettingsData)];
+
+    #ifdef RAMEND
+      static_assert(sizeof(eeprom_image) <= (RAMEND - RAMSTART + 1) / 8, "EEPROM_STAGED_WRITE would take over 1/8 of SRAM for the settings image. Disable it for this board.");
+    #endif
+
+    // The CRC covers everything after the version and the CRC itself
+    constexpr uint16_t eeprom_data_start = offsetof(SettingsData, crc) + sizeof(SettingsData::crc);
+
+    static void stage_write(int &pos, const void * const value, const size_t size) {
+      const int i = pos - (EEPROM_OFFSET);
+      if (i >= 0 && i + size <= sizeof(eeprom_image)) memcpy(&eeprom_image[i], value, size);
+      pos += size;
+    }
+
+    static void stage_read(int &pos, void * const value, const size_t size, const bool apply=true) {
+      const int i = pos - (EEPROM_OFFSET);
+      if (apply && i >= 0 && i + size <= sizeof(eeprom_image)) memcpy(value, &eeprom_image[i], size);
+      pos += size;
+    }
+
+    static uint16_t image_crc(const int end) {
+      uint16_t crc = 0;
+      const int size = _MIN(end - (EEPROM_OFFSET), int(sizeof(eeprom_image))) - eeprom_data_start;
+      if (size > 0) crc16(&crc, &eeprom_image[eeprom_data_start], size);
+      return crc;
+    }
+
+    /**
+     * Write the blocks of a range that differ from the store. Unless the
+     * store only commits on access_finish, the stored version is spoiled
+     * before the first write, so an interrupted save always leaves invalid
+     * settings behind.
+     */
+    static bool commit_bytes(const int pos, const uint8_t * const data, const uint16_t size, bool &spoiled) {
+      uint8_t stored[EEPROM_STAGE_BLOCK];
+      for (uint16_t i = 0; i < size; i += EEPROM_STAGE_BLOCK) {
+        const size_t n = _MIN(size - i, EEPROM_STAGE_BLOCK);
+        if (persistentStore.read_data(pos + i, stored, n)) return true;
+        if (!memcmp(stored, &data[i], n)) continue;
+        if (!spoiled) {
+          const char ver[4] = "ERR";
+          if (persistentStore.write_data(EEPROM_OFFSET, (const uint8_t*)ver, sizeof(ver))) return true;
+          spoiled = true;
+        }
+        if (persistentStore.write_data(pos + i, &data[i], n)) return true;
+      }
+      return false;
+    }
+
+    #if ENABLED(EEPROM_TAGGED_SETTINGS)
+
+      /**
+       * The store holds one tagged record for each group of settings
+       * instead of the image itself:
+       *
+       *   "T01" | crc | tag size data | tag size data | ... | 0 0
+       *
+       * The tag is a hash of the name of the SettingsData field that starts
+       * the group and the CRC covers everything after it. M501 lays the
+       * records it knows over an image in the current layout, so a group
+       * that grew keeps its leading fields, a group that is gone is skipped,
+       * and a new group gets its defaults. Give a field a new name when its
+       * type or meaning changes, so the old data isn't carried over.
+       */
+      #define EEPROM_TAGGED_VERSION "T01"
+      #ifndef EEPROM_TAGGED_RECORDS
+        #define EEPROM_TAGGED_RECORDS 48
+      #endif
+
+      typedef struct { uint16_t tag, start; bool stored; } eeprom_record_t;
+
+      static eeprom_record_t eeprom_records[EEPROM_TAGGED_RECORDS];
+      static uint8_t eeprom_record_count;
+      static bool eeprom_stage_only,      // save() only builds the image
+                  eeprom_loaded;          // Settings were loaded from the store
+
+      // Every record name, so the tags can be checked at compile time
+      constexpr const char * const record_names[] = {
+        "esteppers", "planner_settings.min_segment_time_us", "planner_settings.max_feedrate_mm_s",
+        "planner_settings.acceleration", "home_offset", "runout_sensor_enabled", "probe_offset",
+        "planner_leveling_active", "servo_angles", "bltouch_last_written_mode", "delta_height",
+        "x2_endstop_adj", "ui_material_preset", "hotendPID", "lpq_len", "bedPID", "user_thermistor",
+        "power_monitor_flags", "lcd_contrast", "controllerFan_settings", "recovery_enabled",
+        "fwretract_settings", "parser_volumetric_enabled", "planner_volumetric_extruder_limit",
+        "tmc_stepper_current", "tmc_hybrid_threshold", "tmc_sgt", "tmc_stealth_enabled",
+        "planner_extruder_advance_K", "motor_current_setting", "coordinate_system",
+        "planner_skew_factor", "fc_settings", "toolchange_settings", "backlash_distance_mm",
+        "extui_data", "caselight_brightness", "password_is_set", "touch_calibration"
+      };
+
+      constexpr bool same_name(const char * const a, const char * const b) {
+        return *a == *b && (!*a || same_name(a + 1, b + 1));
+      }
+      constexpr bool record_listed(const char * const name, const uint8_t i=0) {
+        return i < COUNT(record_names) && (same_name(name, record_names[i]) || record_listed(name, i + 1));
+      }
+      constexpr bool tag_unique(const uint8_t i, const uint8_t j) {
+        return j >= COUNT(record_names) || (MarlinSettings::record_tag(record_names[i]) != MarlinSettings::record_tag(record_names[j]) && tag_unique(i, j + 1));
+      }
+      constexpr bool tags_unique(const uint8_t i=0) {
+        return i >= COUNT(record_names) || (tag_unique(i, i + 1) && tags_unique(i + 1));
+      }
+      static_assert(tags_unique(), "Two EEPROM records have the same tag. Give one of their fields a new name.");
+
+      static bool stage_record(const int pos, const uint16_t tag) {
+        if (eeprom_record_count >= COUNT(eeprom_records)) return false;
+        eeprom_records[eeprom_record_count++] = { tag, uint16_t(pos - (EEPROM_OFFSET)), false };
+        return true;
+      }
+
+      #define EEPROM_RECORD(FIELD) do{ \
+        static_assert(record_listed(STRINGIFY(FIELD)), "Add " STRINGIFY(FIELD) " to the EEPROM record_names."); \
+        _FIELD_TEST(FIELD); \
+        constexpr uint16_t tag = MarlinSettings::record_tag(STRINGIFY(FIELD)); \
+        EEPROM_ASSERT(stage_record(eeprom_index, tag), "EEPROM record " STRINGIFY(FIELD) " not added. Raise EEPROM_TAGGED_RECORDS."); \
+      }while(0)
+
+      static uint16_t record_end(const uint8_t r, const uint16_t size) {
+        return r + 1 < eeprom_record_count ? eeprom_records[r + 1].start : size;
+      }
+
+      static int record_pos(const uint16_t tag) {
+        LOOP_L_N(r, eeprom_record_count) if (eeprom_records[r].tag == tag) return EEPROM_OFFSET + eeprom_records[r].start;
+        return -1;
+      }
+
+      // Whether a group came from the store, not the staged settings
+      static inline bool record_stored(const uint16_t tag) {
+        LOOP_L_N(r, eeprom_record_count) if (eeprom_records[r].tag == tag) return eeprom_records[r].stored;
+        return false;
+      }
+      #define EEPROM_STORED(FIELD) (!tagged || record_stored(MarlinSettings::record_tag(STRINGIFY(FIELD))))
+
+      /**
+       * Continue reading a tagged store at the staged start of a group, since
+       * the stored group before it may have had another size. Any other store
+       * is read straight through.
+       */
+      #define EEPROM_SEEK(FIELD) do{ \
+        if (tagged) { \
+          constexpr uint16_t tag = MarlinSettings::record_tag(STRINGIFY(FIELD)); \
+          const int pos = record_pos(tag); \
+          EEPROM_ASSERT(pos >= 0, "EEPROM record " STRINGIFY(FIELD) " not found."); \
+          if (pos >= 0) eeprom_index = pos; \
+        } \
+        _FIELD_TEST(FIELD); \
+      }while(0)
+
+      // Write the records that changed, with the header going last
+      static bool commit_tagged(const uint16_t size) {
+        if (EEPROM_OFFSET + size + (eeprom_record_count + 1) * 2 * sizeof(uint16_t) > persistentStore.capacity()) return true;
+
+        bool spoiled = ENABLED(FLASH_EEPROM_EMULATION);
+        int pos = EEPROM_OFFSET + eeprom_data_start;
+        uint16_t crc = 0;
+        for (uint8_t r = 0; r <= eeprom_record_count; r++) {
+          const bool end = r == eeprom_record_count;
+          const uint16_t start = end ? size : eeprom_records[r].start,
+                         head[2] = { end ? uint16_t(0) : eeprom_records[r].tag, uint16_t(end ? 0 : record_end(r, size) - start) };
+          crc16(&crc, (const uint8_t*)head, sizeof(head));
+          crc16(&crc, &eeprom_image[start], head[1]);
+          if (commit_bytes(pos, (const uint8_t*)head, sizeof(head), spoiled)) return true;
+          pos += sizeof(head);
+          if (commit_bytes(pos, &eeprom_image[start], head[1], spoiled)) return true;
+          pos += head[1];
+        }
+
+        uint8_t header[eeprom_data_start];
+        memcpy(header, EEPROM_TAGGED_VERSION, 4);
+        memcpy(&header[4], &crc, sizeof(crc));
+        return commit_bytes(EEPROM_OFFSET, header, sizeof(header), spoiled);
+      }
+
+      /**
+       * If the store is tagged, lay its records over the staged image and
+       * give the image the current version and the stored CRC, so it loads
+       * as usual. Set 'partial' if the records don't cover the whole image.
+       * Return false if the store isn't tagged.
+       */
+      static bool read_tagged(const uint16_t size, uint16_t &crc, uint8_t &dropped, bool &partial) {
+        char stored_ver[4];
+        uint16_t stored_crc;
+        if (persistentStore.read_data(EEPROM_OFFSET, (uint8_t*)stored_ver, sizeof(stored_ver))
+          || strncmp(stored_ver, EEPROM_TAGGED_VERSION, 3) != 0
+        ) return false;
+
+        int pos = EEPROM_OFFSET + sizeof(stored_ver);
+        persistentStore.read_data(pos, (uint8_t*)&stored_crc, sizeof(stored_crc), &crc);
+        crc = 0;
+        dropped = 0;
+        uint8_t matched = 0;
+        bool shorter = false;
+        for (;;) {
+          uint16_t head[2];
+          if (persistentStore.read_data(pos, (uint8_t*)head, sizeof(head), &crc)) break;
+          if (!head[0]) break;
+
+          uint16_t n = 0;
+          uint8_t r = 0;
+          while (r < eeprom_record_count && eeprom_records[r].tag != head[0]) r++;
+          if (r < eeprom_record_count) {
+            const uint16_t start = eeprom_records[r].start, len = record_end(r, size) - start;
+            n = _MIN(head[1], len);
+            if (persistentStore.read_data(pos, &eeprom_image[start], n, &crc)) break;
+            eeprom_records[r].stored = true;
+            matched++;
+            if (n < len) shorter = true;
+          }
+          else
+            dropped++;
+
+          // The rest of the record only counts toward the CRC
+          for (uint8_t skip[EEPROM_STAGE_BLOCK]; n < head[1];) {
+            const uint16_t k = _MIN(head[1] - n, EEPROM_STAGE_BLOCK);
+            if (persistentStore.read_data(pos, skip, k, &crc)) break;
+            n += k;
+          }
+        }
+
+        partial = shorter || matched < eeprom_record_count;
+
+        memcpy(eeprom_image, EEPROM_VERSION, sizeof(SettingsData::version));
+        memcpy(&eeprom_image[offsetof(SettingsData, crc)], &stored_crc, sizeof(stored_crc));
+        return true;
+      }
+
+      /**
+       * Build the image and the record list from the current settings,
+       * without the store hooks. The UI data is staged empty.
+       */
+      static void stage_settings() {
+        eeprom_stage_only = true;
+        (void)settings.save();
+        eeprom_stage_only = false;
+      }
+
+      // Check whether the store is tagged and lacks part of the current layout
+      static bool store_is_partial(const uint16_t size) {
+        if (!persistentStore.access_start()) return false;
+        uint16_t crc;
+        uint8_t dropped;
+        bool partial;
+        const bool tagged = read_tagged(size, crc, dropped, partial);
+        persistentStore.access_finish();
+        return tagged && partial;
+      }
+
+      void MarlinSettings::stage_image(uint8_t * const image) {
+        stage_settings();
+        memcpy(image, eeprom_image, sizeof(eeprom_image));
+      }
+
+      int MarlinSettings::store_offset() { return EEPROM_OFFSET; }
+
+    #else
+
+      // Write the changed parts of the image, with the header going last
+      static bool commit_image(const uint16_t size) {
+        bool spoiled = ENABLED(FLASH_EEPROM_EMULATION);
+        return commit_bytes(EEPROM_OFFSET + eeprom_data_start, &eeprom_image[eeprom_data_start], size - eeprom_data_start, spoiled)
+            || commit_bytes(EEPROM_OFFSET, eeprom_image, eeprom_data_start, spoiled);
+      }
+
+    #endif
+
+    #define EEPROM_WRITE(VAR)       stage_write(eeprom_index, &VAR, sizeof(VAR))
+    #define EEPROM_READ(VAR)        stage_read(eeprom_index, (void*)&VAR, sizeof(VAR), !validating)
+    #define EEPROM_READ_ALWAYS(VAR) stage_read(eeprom_index, &VAR, sizeof(VAR))
+
+  #else
+
+    #define EEPROM_WRITE(VAR)       do{ persistentStore.write_data(eeprom_index, (uint8_t*)&VAR, sizeof(VAR), &working_crc);              }while(0)
+    #define EEPROM_READ(VAR)        do{ persistentStore.read_data(eeprom_index, (uint8_t*)&VAR, sizeof(VAR), &working_crc, !validating);  }while(0)
+    #define EEPROM_READ_ALWAYS(VAR) do{ persistentStore.read_data(eeprom_index, (uint8_t*)&VAR, sizeof(VAR), &working_crc);               }while(0)
+
+  #endif
+
   #define EEPROM_ASSERT(TST,ERR)  do{ if (!(TST)) { SERIAL_ERROR_MSG(ERR); eeprom_error = true; } }while(0)
 
   #if ENABLED(DEBUG_EEPROM_READWRITE)
@@ -561,6 +848,13 @@ void MarlinSettings::postprocess() {
     #define _FIELD_TEST(FIELD) NOOP
   #endif
 
+  // Mark the start of a group of settings
+  #if DISABLED(EEPROM_TAGGED_SETTINGS)
+    #define EEPROM_RECORD(FIELD) _FIELD_TEST(FIELD)
+    #define EEPROM_SEEK(FIELD) _FIELD_TEST(FIELD)
+    #define EEPROM_STORED(FIELD) true
+  #endif
+
   const char version[4] = EEPROM_VERSION;
 
   bool MarlinSettings::eeprom_error, MarlinSettings::validating;
@@ -585,6 +879,7 @@ void MarlinSettings::postprocess() {
     EEPROM_START();
 
     eeprom_error = false;
+    TERN_(EEPROM_TAGGED_SETTINGS, eeprom_record_count = 0);
 
     // Write or Skip version. (Flash doesn't allow rewrite without erase.)
     TERN(FLASH_EEPROM_EMULATION, EEPROM_SKIP, EEPROM_WRITE)(ver);
@@ -593,7 +888,7 @@ void MarlinSettings::postprocess() {
 
     working_crc = 0; // clear before first "real data"
 
-    _FIELD_TEST(esteppers);
+    EEPROM_RECORD(esteppers);
 
     const uint8_t esteppers = COUNT(planner.settings.axis_steps_per_mm) - XYZ;
     EEPROM_WRITE(esteppers);
@@ -602,7 +897,20 @@ void MarlinSettings::postprocess() {
     // Planner Motion
     //
     {
-      EEPROM_WRITE(planner.settings);
+      // Each group ends with the one array sized by esteppers,
+      // so a store with a different count still lines up.
+      EEPROM_WRITE(planner.settings.max_acceleration_mm_per_s2);
+      EEPROM_RECORD(planner_settings.min_segment_time_us);
+      EEPROM_WRITE(planner.settings.min_segment_time_us);
+      EEPROM_WRITE(planner.settings.axis_steps_per_mm);
+      EEPROM_RECORD(planner_settings.max_feedrate_mm_s);
+      EEPROM_WRITE(planner.settings.max_feedrate_mm_s);
+      EEPROM_RECORD(planner_settings.acceleration);
+      EEPROM_WRITE(planner.settings.acceleration);
+      EEPROM_WRITE(planner.settings.retract_acceleration);
+      EEPROM_WRITE(planner.settings.travel_acceleration);
+      EEPROM_WRITE(planner.settings.min_feedrate_mm_s);
+      EEPROM_WRITE(planner.settings.min_travel_feedrate_mm_s);
 
       #if HAS_CLASSIC_JERK
         EEPROM_WRITE(planner.max_jerk);
@@ -623,7 +931,7 @@ void MarlinSettings::postprocess() {
     // Home Offset
     //
     {
-      _FIELD_TEST(home_offset);
+      EEPROM_RECORD(home_offset);
 
       #if HAS_SCARA_OFFSET
         EEPROM_WRITE(scara_home_offset);
@@ -655,7 +963,7 @@ void MarlinSettings::postprocess() {
       #else
         constexpr int8_t runout_sensor_enabled = -1;
       #endif
-      _FIELD_TEST(runout_sensor_enabled);
+      EEPROM_RECORD(runout_sensor_enabled);
       EEPROM_WRITE(runout_sensor_enabled);
 
       #if HAS_FILAMENT_RUNOUT_DISTANCE
@@ -705,7 +1013,7 @@ void MarlinSettings::postprocess() {
     // Probe XYZ Offsets
     //
     {
-      _FIELD_TEST(probe_offset);
+      EEPROM_RECORD(probe_offset);
       #if HAS_BED_PROBE
         const xyz_pos_t &zpo = probe.offset;
       #else
@@ -758,7 +1066,7 @@ void MarlinSettings::postprocess() {
     // Unified Bed Leveling
     //
     {
-      _FIELD_TEST(planner_leveling_active);
+      EEPROM_RECORD(planner_leveling_active);
       const bool ubl_active = TERN(AUTO_BED_LEVELING_UBL, planner.leveling_active, false);
       const int8_t storage_slot = TERN(AUTO_BED_LEVELING_UBL, ubl.storage_slot, -1);
       EEPROM_WRITE(ubl_active);
@@ -769,7 +1077,7 @@ void MarlinSettings::postprocess() {
     // Servo Angles
     //
     {
-      _FIELD_TEST(servo_angles);
+      EEPROM_RECORD(servo_angles);
       #if !HAS_SERVO_ANGLES
         uint16_t servo_angles[EEPROM_NUM_SERVOS][2] = { { 0, 0 } };
       #endif
@@ -793,7 +1101,7 @@ void MarlinSettings::postprocess() {
     // BLTOUCH
     //
     {
-      _FIELD_TEST(bltouch_last_written_mode);
+      EEPROM_RECORD(bltouch_last_written_mode);
       const bool bltouch_last_written_mode = TERN(BLTOUCH, bltouch.last_written_mode, false);
       EEPROM_WRITE(bltouch_last_written_mode);
     }
@@ -804,7 +1112,7 @@ void MarlinSettings::postprocess() {
     {
       #if ENABLED(DELTA)
 
-        _FIELD_TEST(delta_height);
+        EEPROM_RECORD(delta_height);
 
         EEPROM_WRITE(delta_height);              // 1 float
         EEPROM_WRITE(delta_endstop_adj);         // 3 floats
@@ -816,7 +1124,7 @@ void MarlinSettings::postprocess() {
 
       #elif HAS_EXTRA_ENDSTOPS
 
-        _FIELD_TEST(x2_endstop_adj);
+        EEPROM_RECORD(x2_endstop_adj);
 
         // Write dual endstops in X, Y, Z order. Unused = 0.0
         dummyf = 0;
@@ -850,7 +1158,7 @@ void MarlinSettings::postprocess() {
     // LCD Preheat settings
     //
     #if PREHEAT_COUNT
-      _FIELD_TEST(ui_material_preset);
+      EEPROM_RECORD(ui_material_preset);
       EEPROM_WRITE(ui.material_preset);
     #endif
 
@@ -858,7 +1166,7 @@ void MarlinSettings::postprocess() {
     // PIDTEMP
     //
     {
-      _FIELD_TEST(hotendPID);
+      EEPROM_RECORD(hotendPID);
       HOTEND_LOOP() {
         PIDCF_t pidcf = {
           #if DISABLED(PIDTEMP)
@@ -875,7 +1183,7 @@ void MarlinSettings::postprocess() {
         EEPROM_WRITE(pidcf);
       }
 
-      _FIELD_TEST(lpq_len);
+      EEPROM_RECORD(lpq_len);
       #if DISABLED(PID_EXTRUSION_SCALING)
         const int16_t lpq_len = 20;
       #endif
@@ -886,7 +1194,7 @@ void MarlinSettings::postprocess() {
     // PIDTEMPBED
     //
     {
-      _FIELD_TEST(bedPID);
+      EEPROM_RECORD(bedPID);
 
       const PID_t bed_pid = {
         #if DISABLED(PIDTEMPBED)
@@ -906,7 +1214,7 @@ void MarlinSettings::postprocess() {
     //
     #if HAS_USER_THERMISTORS
     {
-      _FIELD_TEST(user_thermistor);
+      EEPROM_RECORD(user_thermistor);
       EEPROM_WRITE(thermalManager.user_thermistor);
     }
     #endif
@@ -920,7 +1228,7 @@ void MarlinSettings::postprocess() {
       #else
         constexpr uint8_t power_monitor_flags = 0x00;
       #endif
-      _FIELD_TEST(power_monitor_flags);
+      EEPROM_RECORD(power_monitor_flags);
       EEPROM_WRITE(power_monitor_flags);
     }
 
@@ -928,7 +1236,7 @@ void MarlinSettings::postprocess() {
     // LCD Contrast
     //
     {
-      _FIELD_TEST(lcd_contrast);
+      EEPROM_RECORD(lcd_contrast);
 
       const int16_t lcd_contrast =
         #if HAS_LCD_CONTRAST
@@ -944,7 +1252,7 @@ void MarlinSettings::postprocess() {
     // Controller Fan
     //
     {
-      _FIELD_TEST(controllerFan_settings);
+      EEPROM_RECORD(controllerFan_settings);
       #if ENABLED(USE_CONTROLLER_FAN)
         const controllerFan_settings_t &cfs = controllerFan.settings;
       #else
@@ -957,7 +1265,7 @@ void MarlinSettings::postprocess() {
     // Power-Loss Recovery
     //
     {
-      _FIELD_TEST(recovery_enabled);
+      EEPROM_RECORD(recovery_enabled);
       const bool recovery_enabled = TERN(POWER_LOSS_RECOVERY, recovery.enabled, ENABLED(PLR_ENABLED_DEFAULT));
       EEPROM_WRITE(recovery_enabled);
     }
@@ -966,7 +1274,7 @@ void MarlinSettings::postprocess() {
     // Firmware Retraction
     //
     {
-      _FIELD_TEST(fwretract_settings);
+      EEPROM_RECORD(fwretract_settings);
       #if DISABLED(FWRETRACT)
         const fwretract_settings_t autoretract_defaults = { 3, 45, 0, 0, 0, 13, 0, 8 };
       #endif
@@ -982,12 +1290,14 @@ void MarlinSettings::postprocess() {
     // Volumetric & Filament Size
     //
     {
-      _FIELD_TEST(parser_volumetric_enabled);
+      // Each group ends with the one array sized by EXTRUDERS
+      EEPROM_RECORD(parser_volumetric_enabled);
 
       #if DISABLED(NO_VOLUMETRICS)
 
         EEPROM_WRITE(parser.volumetric_enabled);
         EEPROM_WRITE(planner.filament_size);
+        EEPROM_RECORD(planner_volumetric_extruder_limit);
         #if ENABLED(VOLUMETRIC_EXTRUDER_LIMIT)
           EEPROM_WRITE(planner.volumetric_extruder_limit);
         #else
@@ -1001,6 +1311,7 @@ void MarlinSettings::postprocess() {
         EEPROM_WRITE(volumetric_enabled);
         dummyf = DEFAULT_NOMINAL_FILAMENT_DIA;
         for (uint8_t q = EXTRUDERS; q--;) EEPROM_WRITE(dummyf);
+        EEPROM_RECORD(planner_volumetric_extruder_limit);
         dummyf = DEFAULT_VOLUMETRIC_EXTRUDER_LIMIT;
         for (uint8_t q = EXTRUDERS; q--;) EEPROM_WRITE(dummyf);
 
@@ -1011,7 +1322,7 @@ void MarlinSettings::postprocess() {
     // TMC Configuration
     //
     {
-      _FIELD_TEST(tmc_stepper_current);
+      EEPROM_RECORD(tmc_stepper_current);
 
       tmc_stepper_current_t tmc_stepper_current = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
@@ -1088,7 +1399,7 @@ void MarlinSettings::postprocess() {
     // TMC Hybrid Threshold, and placeholder values
     //
     {
-      _FIELD_TEST(tmc_hybrid_threshold);
+      EEPROM_RECORD(tmc_hybrid_threshold);
 
       #if ENABLED(HYBRID_THRESHOLD)
        tmc_hybrid_threshold_t tmc_hybrid_threshold = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
@@ -1171,6 +1482,7 @@ void MarlinSettings::postprocess() {
     // TMC StallGuard threshold
     //
     {
+      EEPROM_RECORD(tmc_sgt);
       tmc_sgt_t tmc_sgt{0};
       #if USE_SENSORLESS
         TERN_(X_SENSORLESS,  tmc_sgt.X  = stepperX.homing_threshold());
@@ -1189,7 +1501,7 @@ void MarlinSettings::postprocess() {
     // TMC stepping mode
     //
     {
-      _FIELD_TEST(tmc_stealth_enabled);
+      EEPROM_RECORD(tmc_stealth_enabled);
 
       tmc_stealth_enabled_t tmc_stealth_enabled = { false, false, false, false, false, false, false, false, false, false, false, false, false };
 
@@ -1266,7 +1578,7 @@ void MarlinSettings::postprocess() {
     // Linear Advance
     //
     {
-      _FIELD_TEST(planner_extruder_advance_K);
+      EEPROM_RECORD(planner_extruder_advance_K);
 
       #if ENABLED(LIN_ADVANCE)
         EEPROM_WRITE(planner.extruder_advance_K);
@@ -1280,7 +1592,7 @@ void MarlinSettings::postprocess() {
     // Motor Current PWM
     //
     {
-      _FIELD_TEST(motor_current_setting);
+      EEPROM_RECORD(motor_current_setting);
 
       #if HAS_MOTOR_CURRENT_PWM
         EEPROM_WRITE(stepper.motor_current_setting);
@@ -1294,7 +1606,7 @@ void MarlinSettings::postprocess() {
     // CNC Coordinate Systems
     //
 
-    _FIELD_TEST(coordinate_system);
+    EEPROM_RECORD(coordinate_system);
 
     #if DISABLED(CNC_COORDINATE_SYSTEMS)
       const xyz_pos_t coordinate_system[MAX_COORDINATE_SYSTEMS] = { { 0 } };
@@ -1304,7 +1616,7 @@ void MarlinSettings::postprocess() {
     //
     // Skew correction factors
     //
-    _FIELD_TEST(planner_skew_factor);
+    EEPROM_RECORD(planner_skew_factor);
     EEPROM_WRITE(planner.skew_factor);
 
     //
@@ -1315,7 +1627,7 @@ void MarlinSettings::postprocess() {
       #if DISABLED(ADVANCED_PAUSE_FEATURE)
         const fil_change_settings_t fc_settings[EXTRUDERS] = { 0, 0 };
       #endif
-      _FIELD_TEST(fc_settings);
+      EEPROM_RECORD(fc_settings);
       EEPROM_WRITE(fc_settings);
     }
     #endif
@@ -1325,7 +1637,7 @@ void MarlinSettings::postprocess() {
     //
 
     #if EXTRUDERS > 1
-      _FIELD_TEST(toolchange_settings);
+      EEPROM_RECORD(toolchange_settings);
       EEPROM_WRITE(toolchange_settings);
     #endif
 
@@ -1345,7 +1657,7 @@ void MarlinSettings::postprocess() {
       #else
         const float backlash_smoothing_mm = 3;
       #endif
-      _FIELD_TEST(backlash_distance_mm);
+      EEPROM_RECORD(backlash_distance_mm);
       EEPROM_WRITE(backlash_distance_mm);
       EEPROM_WRITE(backlash_correction);
       EEPROM_WRITE(backlash_smoothing_mm);
@@ -1357,8 +1669,8 @@ void MarlinSettings::postprocess() {
     #if ENABLED(EXTENSIBLE_UI)
       {
         char extui_data[ExtUI::eeprom_data_size] = { 0 };
-        ExtUI::onStoreSettings(extui_data);
-        _FIELD_TEST(extui_data);
+        if (TERN1(EEPROM_TAGGED_SETTINGS, !eeprom_stage_only)) ExtUI::onStoreSettings(extui_data);
+        EEPROM_RECORD(extui_data);
         EEPROM_WRITE(extui_data);
       }
     #endif
@@ -1367,6 +1679,7 @@ void MarlinSettings::postprocess() {
     // Case Light Brightness
     //
     #if HAS_CASE_LIGHT_BRIGHTNESS
+      EEPROM_RECORD(caselight_brightness);
       EEPROM_WRITE(caselight.brightness);
     #endif
 
@@ -1374,6 +1687,7 @@ void MarlinSettings::postprocess() {
     // Password feature
     //
     #if ENABLED(PASSWORD_FEATURE)
+      EEPROM_RECORD(password_is_set);
       EEPROM_WRITE(password.is_set);
       EEPROM_WRITE(password.value);
     #endif
@@ -1382,12 +1696,22 @@ void MarlinSettings::postprocess() {
     // TOUCH_SCREEN_CALIBRATION
     //
     #if ENABLED(TOUCH_SCREEN_CALIBRATION)
+      EEPROM_RECORD(touch_calibration);
       EEPROM_WRITE(touch.calibration);
     #endif
 
+    #if ENABLED(EEPROM_TAGGED_SETTINGS)
+      if (eeprom_stage_only) {
+        EEPROM_FINISH();
+        return !eeprom_error;
+      }
+    #endif
+
     //
     // Validate CRC and Data Size
     //
+    TERN_(EEPROM_STAGED_WRITE, working_crc = image_crc(eeprom_index));
+
     if (!eeprom_error) {
       const uint16_t eeprom_size = eeprom_index - (EEPROM_OFFSET),
                      final_crc = working_crc;
@@ -1403,6 +1727,13 @@ void MarlinSettings::postprocess() {
       DEBUG_ECHOLNPAIR("Settings Stored (", eeprom_size, " bytes; crc ", (uint32_t)final_crc, ")");
 
       eeprom_error |= size_error(eeprom_size);
+
+      #if ENABLED(EEPROM_STAGED_WRITE)
+        if (!eeprom_error && TERN(EEPROM_TAGGED_SETTINGS, commit_tagged, commit_image)(eeprom_size)) {
+          SERIAL_ERROR_MSG(STR_ERR_EEPROM_WRITE);
+          eeprom_error = true;
+        }
+      #endif
     }
     EEPROM_FINISH();
 
@@ -1427,8 +1758,25 @@ void MarlinSettings::postprocess() {
   bool MarlinSettings::_load() {
     uint16_t working_crc = 0;
 
+    #if ENABLED(EEPROM_TAGGED_SETTINGS)
+      // Stage the current settings for the stored records to cover, so a group
+      // the store lacks keeps its value. Nothing is set before the first load,
+      // so then a store that lacks groups starts from the defaults.
+      if (!validating && !eeprom_loaded && store_is_partial(datasize())) reset();
+      stage_settings();
+    #endif
+
     EEPROM_START();
 
+    #if ENABLED(EEPROM_TAGGED_SETTINGS)
+      uint16_t tagged_crc;
+      uint8_t dropped;
+      bool partial;
+      const bool tagged = read_tagged(datasize(), tagged_crc, dropped, partial);
+      if (!tagged)
+    #endif
+        TERN_(EEPROM_STAGED_WRITE, persistentStore.read_data(eeprom_index, eeprom_image, sizeof(eeprom_image)));
+
     char stored_ver[4];
     EEPROM_READ_ALWAYS(stored_ver);
 
@@ -1450,7 +1798,7 @@ void MarlinSettings::postprocess() {
       float dummyf = 0;
       working_crc = 0;  // Init to 0. Accumulated by EEPROM_READ
 
-      _FIELD_TEST(esteppers);
+      EEPROM_SEEK(esteppers);
 
       // Number of esteppers may change
       uint8_t esteppers;
@@ -1466,8 +1814,10 @@ void MarlinSettings::postprocess() {
         float tmp2[XYZ + esteppers];
         feedRate_t tmp3[XYZ + esteppers];
         EEPROM_READ(tmp1);                         // max_acceleration_mm_per_s2
+        EEPROM_SEEK(planner_settings.min_segment_time_us);
         EEPROM_READ(planner.settings.min_segment_time_us);
         EEPROM_READ(tmp2);                         // axis_steps_per_mm
+        EEPROM_SEEK(planner_settings.max_feedrate_mm_s);
         EEPROM_READ(tmp3);                         // max_feedrate_mm_s
 
         if (!validating) LOOP_XYZE_N(i) {
@@ -1477,6 +1827,7 @@ void MarlinSettings::postprocess() {
           planner.settings.max_feedrate_mm_s[i]          = in ? tmp3[i] : pgm_read_float(&_DMF[ALIM(i, _DMF)]);
         }
 
+        EEPROM_SEEK(planner_settings.acceleration);
         EEPROM_READ(planner.settings.acceleration);
         EEPROM_READ(planner.settings.retract_acceleration);
         EEPROM_READ(planner.settings.travel_acceleration);
@@ -1499,7 +1850,7 @@ void MarlinSettings::postprocess() {
       // Home Offset (M206 / M665)
       //
       {
-        _FIELD_TEST(home_offset);
+        EEPROM_SEEK(home_offset);
 
         #if HAS_SCARA_OFFSET
           EEPROM_READ(scara_home_offset);
@@ -1527,7 +1878,7 @@ void MarlinSettings::postprocess() {
       //
       {
         int8_t runout_sensor_enabled;
-        _FIELD_TEST(runout_sensor_enabled);
+        EEPROM_SEEK(runout_sensor_enabled);
         EEPROM_READ(runout_sensor_enabled);
         #if HAS_FILAMENT_SENSOR
           runout.enabled = runout_sensor_enabled < 0 ? FIL_RUNOUT_ENABLED_DEFAULT : runout_sensor_enabled;
@@ -1577,7 +1928,7 @@ void MarlinSettings::postprocess() {
       // Probe Z Offset
       //
       {
-        _FIELD_TEST(probe_offset);
+        EEPROM_SEEK(probe_offset);
         #if HAS_BED_PROBE
           const xyz_pos_t &zpo = probe.offset;
         #else
@@ -1626,7 +1977,7 @@ void MarlinSettings::postprocess() {
       // Unified Bed Leveling active state
       //
       {
-        _FIELD_TEST(planner_leveling_active);
+        EEPROM_SEEK(planner_leveling_active);
         #if ENABLED(AUTO_BED_LEVELING_UBL)
           const bool &planner_leveling_active = planner.leveling_active;
           const int8_t &ubl_storage_slot = ubl.storage_slot;
@@ -1642,7 +1993,7 @@ void MarlinSettings::postprocess() {
       // SERVO_ANGLES
       //
       {
-        _FIELD_TEST(servo_angles);
+        EEPROM_SEEK(servo_angles);
         #if ENABLED(EDITABLE_SERVO_ANGLES)
           uint16_t (&servo_angles_arr)[EEPROM_NUM_SERVOS][2] = servo_angles;
         #else
@@ -1669,7 +2020,7 @@ void MarlinSettings::postprocess() {
       // BLTOUCH
       //
       {
-        _FIELD_TEST(bltouch_last_written_mode);
+        EEPROM_SEEK(bltouch_last_written_mode);
         #if ENABLED(BLTOUCH)
           const bool &bltouch_last_written_mode = bltouch.last_written_mode;
         #else
@@ -1684,7 +2035,7 @@ void MarlinSettings::postprocess() {
       {
         #if ENABLED(DELTA)
 
-          _FIELD_TEST(delta_height);
+          EEPROM_SEEK(delta_height);
 
           EEPROM_READ(delta_height);              // 1 float
           EEPROM_READ(delta_endstop_adj);         // 3 floats
@@ -1696,7 +2047,7 @@ void MarlinSettings::postprocess() {
 
         #elif HAS_EXTRA_ENDSTOPS
 
-          _FIELD_TEST(x2_endstop_adj);
+          EEPROM_SEEK(x2_endstop_adj);
 
           EEPROM_READ(TERN(X_DUAL_ENDSTOPS, endstops.x2_endstop_adj, dummyf));  // 1 float
           EEPROM_READ(TERN(Y_DUAL_ENDSTOPS, endstops.y2_endstop_adj, dummyf));  // 1 float
@@ -1727,7 +2078,7 @@ void MarlinSettings::postprocess() {
       // LCD Preheat settings
       //
       #if PREHEAT_COUNT
-        _FIELD_TEST(ui_material_preset);
+        EEPROM_SEEK(ui_material_preset);
         EEPROM_READ(ui.material_preset);
       #endif
 
@@ -1735,6 +2086,7 @@ void MarlinSettings::postprocess() {
       // Hotend PID
       //
       {
+        EEPROM_SEEK(hotendPID);
         HOTEND_LOOP() {
           PIDCF_t pidcf;
           EEPROM_READ(pidcf);
@@ -1755,7 +2107,7 @@ void MarlinSettings::postprocess() {
       // PID Extrusion Scaling
       //
       {
-        _FIELD_TEST(lpq_len);
+        EEPROM_SEEK(lpq_len);
         #if ENABLED(PID_EXTRUSION_SCALING)
           const int16_t &lpq_len = thermalManager.lpq_len;
         #else
@@ -1768,6 +2120,7 @@ void MarlinSettings::postprocess() {
       // Heated Bed PID
       //
       {
+        EEPROM_SEEK(bedPID);
         PID_t pid;
         EEPROM_READ(pid);
         #if ENABLED(PIDTEMPBED)
@@ -1785,8 +2138,11 @@ void MarlinSettings::postprocess() {
       //
       #if HAS_USER_THERMISTORS
       {
-        _FIELD_TEST(user_thermistor);
+        EEPROM_SEEK(user_thermistor);
         EEPROM_READ(thermalManager.user_thermistor);
+        #ifdef USER_THERMISTOR_TABLE
+          if (!validating) LOOP_L_N(i, USER_THERMISTORS) thermalManager.user_thermistor[i].pre_calc = true;
+        #endif
       }
       #endif
 
@@ -1799,7 +2155,7 @@ void MarlinSettings::postprocess() {
         #else
           uint8_t power_monitor_flags;
         #endif
-        _FIELD_TEST(power_monitor_flags);
+        EEPROM_SEEK(power_monitor_flags);
         EEPROM_READ(power_monitor_flags);
       }
 
@@ -1807,7 +2163,7 @@ void MarlinSettings::postprocess() {
       // LCD Contrast
       //
       {
-        _FIELD_TEST(lcd_contrast);
+        EEPROM_SEEK(lcd_contrast);
 
         int16_t lcd_contrast;
         EEPROM_READ(lcd_contrast);
@@ -1818,7 +2174,7 @@ void MarlinSettings::postprocess() {
       // Controller Fan
       //
       {
-        _FIELD_TEST(controllerFan_settings);
+        EEPROM_SEEK(controllerFan_settings);
         #if ENABLED(CONTROLLER_FAN_EDITABLE)
           const controllerFan_settings_t &cfs = controllerFan.settings;
         #else
@@ -1831,7 +2187,7 @@ void MarlinSettings::postprocess() {
       // Power-Loss Recovery
       //
       {
-        _FIELD_TEST(recovery_enabled);
+        EEPROM_SEEK(recovery_enabled);
         #if ENABLED(POWER_LOSS_RECOVERY)
           const bool &recovery_enabled = recovery.enabled;
         #else
@@ -1844,7 +2200,7 @@ void MarlinSettings::postprocess() {
       // Firmware Retraction
       //
       {
-        _FIELD_TEST(fwretract_settings);
+        EEPROM_SEEK(fwretract_settings);
 
         #if ENABLED(FWRETRACT)
           EEPROM_READ(fwretract.settings);
@@ -1870,8 +2226,11 @@ void MarlinSettings::postprocess() {
           float volumetric_extruder_limit[EXTRUDERS];
         } storage;
 
-        _FIELD_TEST(parser_volumetric_enabled);
-        EEPROM_READ(storage);
+        EEPROM_SEEK(parser_volumetric_enabled);
+        EEPROM_READ(storage.volumetric_enabled);
+        EEPROM_READ(storage.filament_size);
+        EEPROM_SEEK(planner_volumetric_extruder_limit);
+        EEPROM_READ(storage.volumetric_extruder_limit);
 
         #if DISABLED(NO_VOLUMETRICS)
           if (!validating) {
@@ -1892,7 +2251,7 @@ void MarlinSettings::postprocess() {
 
       // TMC Stepper Current
       {
-        _FIELD_TEST(tmc_stepper_current);
+        EEPROM_SEEK(tmc_stepper_current);
 
         tmc_stepper_current_t currents;
         EEPROM_READ(currents);
@@ -1956,7 +2315,7 @@ void MarlinSettings::postprocess() {
       // TMC Hybrid Threshold
       {
         tmc_hybrid_threshold_t tmc_hybrid_threshold;
-        _FIELD_TEST(tmc_hybrid_threshold);
+        EEPROM_SEEK(tmc_hybrid_threshold);
         EEPROM_READ(tmc_hybrid_threshold);
 
         #if ENABLED(HYBRID_THRESHOLD)
@@ -2018,7 +2377,7 @@ void MarlinSettings::postprocess() {
       //
       {
         tmc_sgt_t tmc_sgt;
-        _FIELD_TEST(tmc_sgt);
+        EEPROM_SEEK(tmc_sgt);
         EEPROM_READ(tmc_sgt);
         #if USE_SENSORLESS
           if (!validating) {
@@ -2036,7 +2395,7 @@ void MarlinSettings::postprocess() {
 
       // TMC stepping mode
       {
-        _FIELD_TEST(tmc_stealth_enabled);
+        EEPROM_SEEK(tmc_stealth_enabled);
 
         tmc_stealth_enabled_t tmc_stealth_enabled;
         EEPROM_READ(tmc_stealth_enabled);
@@ -2102,7 +2461,7 @@ void MarlinSettings::postprocess() {
       //
       {
         float extruder_advance_K[_MAX(EXTRUDERS, 1)];
-        _FIELD_TEST(planner_extruder_advance_K);
+        EEPROM_SEEK(planner_extruder_advance_K);
         EEPROM_READ(extruder_advance_K);
         #if ENABLED(LIN_ADVANCE)
           if (!validating)
@@ -2115,7 +2474,7 @@ void MarlinSettings::postprocess() {
       //
       {
         uint32_t motor_current_setting[3];
-        _FIELD_TEST(motor_current_setting);
+        EEPROM_SEEK(motor_current_setting);
         EEPROM_READ(motor_current_setting);
         #if HAS_MOTOR_CURRENT_PWM
           if (!validating)
@@ -2127,7 +2486,7 @@ void MarlinSettings::postprocess() {
       // CNC Coordinate System
       //
       {
-        _FIELD_TEST(coordinate_system);
+        EEPROM_SEEK(coordinate_system);
         #if ENABLED(CNC_COORDINATE_SYSTEMS)
           if (!validating) (void)gcode.select_coordinate_system(-1); // Go back to machine space
           EEPROM_READ(gcode.coordinate_system);
@@ -2142,7 +2501,7 @@ void MarlinSettings::postprocess() {
       //
       {
         skew_factor_t skew_factor;
-        _FIELD_TEST(planner_skew_factor);
+        EEPROM_SEEK(planner_skew_factor);
         EEPROM_READ(skew_factor);
         #if ENABLED(SKEW_CORRECTION_GCODE)
           if (!validating) {
@@ -2163,7 +2522,7 @@ void MarlinSettings::postprocess() {
         #if DISABLED(ADVANCED_PAUSE_FEATURE)
           fil_change_settings_t fc_settings[EXTRUDERS];
         #endif
-        _FIELD_TEST(fc_settings);
+        EEPROM_SEEK(fc_settings);
         EEPROM_READ(fc_settings);
       }
       #endif
@@ -2172,7 +2531,7 @@ void MarlinSettings::postprocess() {
       // Tool-change settings
       //
       #if EXTRUDERS > 1
-        _FIELD_TEST(toolchange_settings);
+        EEPROM_SEEK(toolchange_settings);
         EEPROM_READ(toolchange_settings);
       #endif
 
@@ -2192,7 +2551,7 @@ void MarlinSettings::postprocess() {
         #else
           float backlash_smoothing_mm;
         #endif
-        _FIELD_TEST(backlash_distance_mm);
+        EEPROM_SEEK(backlash_distance_mm);
         EEPROM_READ(backlash_distance_mm);
         EEPROM_READ(backlash_correction);
         EEPROM_READ(backlash_smoothing_mm);
@@ -2205,9 +2564,9 @@ void MarlinSettings::postprocess() {
         // This is a significant hardware change; don't reserve EEPROM space when not present
         {
           const char extui_data[ExtUI::eeprom_data_size] = { 0 };
-          _FIELD_TEST(extui_data);
+          EEPROM_SEEK(extui_data);
           EEPROM_READ(extui_data);
-          if (!validating) ExtUI::onLoadSettings(extui_data);
+          if (!validating && EEPROM_STORED(extui_data)) ExtUI::onLoadSettings(extui_data);
         }
       #endif
 
@@ -2215,7 +2574,7 @@ void MarlinSettings::postprocess() {
       // Case Light Brightness
       //
       #if HAS_CASE_LIGHT_BRIGHTNESS
-        _FIELD_TEST(caselight_brightness);
+        EEPROM_SEEK(caselight_brightness);
         EEPROM_READ(caselight.brightness);
       #endif
 
@@ -2223,7 +2582,7 @@ void MarlinSettings::postprocess() {
       // Password feature
       //
       #if ENABLED(PASSWORD_FEATURE)
-        _FIELD_TEST(password_is_set);
+        EEPROM_SEEK(password_is_set);
         EEPROM_READ(password.is_set);
         EEPROM_READ(password.value);
       #endif
@@ -2232,10 +2591,16 @@ void MarlinSettings::postprocess() {
       // TOUCH_SCREEN_CALIBRATION
       //
       #if ENABLED(TOUCH_SCREEN_CALIBRATION)
-        _FIELD_TEST(touch.calibration);
+        EEPROM_SEEK(touch_calibration);
         EEPROM_READ(touch.calibration);
       #endif
 
+      #if ENABLED(EEPROM_TAGGED_SETTINGS)
+        working_crc = tagged ? tagged_crc : image_crc(eeprom_index);
+      #else
+        TERN_(EEPROM_STAGED_WRITE, working_crc = image_crc(eeprom_index));
+      #endif
+
       eeprom_error = size_error(eeprom_index - (EEPROM_OFFSET));
       if (eeprom_error) {
         DEBUG_ECHO_START();
@@ -2252,9 +2617,18 @@ void MarlinSettings::postprocess() {
         DEBUG_ECHO_START();
         DEBUG_ECHO(version);
         DEBUG_ECHOLNPAIR(" stored settings retrieved (", eeprom_index - (EEPROM_OFFSET), " bytes; crc ", (uint32_t)working_crc, ")");
+        #if ENABLED(EEPROM_TAGGED_SETTINGS)
+          if (tagged && (partial || dropped)) {
+            DEBUG_ECHO_START();
+            DEBUG_ECHOLNPAIR("EEPROM layout changed (", dropped, " groups dropped, missing ones not loaded). M500 to update.");
+          }
+        #endif
       }
 
-      if (!validating && !eeprom_error) postprocess();
+      if (!validating && !eeprom_error) {
+        postprocess();
+        TERN_(EEPROM_TAGGED_SETTINGS, eeprom_loaded = true);
+      }
 
       #if ENABLED(AUTO_BED_LEVELING_UBL)
         if (!validating) {
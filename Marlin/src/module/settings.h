@@ -64,6 +64,21 @@ class MarlinSettings {
         if (!loaded && load()) loaded = true;
       }
 
+      #if ENABLED(EEPROM_TAGGED_SETTINGS)
+        // The tag of the record starting with a SettingsData field: FNV-1a of the field name folded to 16 bits
+        static constexpr uint32_t record_hash(const char * const name, const uint32_t h=2166136261UL) {
+          return *name ? record_hash(name + 1, (h ^ uint8_t(*name)) * 16777619UL) : h;
+        }
+        static constexpr uint16_t record_fold(const uint32_t h) { return uint16_t(h ^ (h >> 16)) ? uint16_t(h ^ (h >> 16)) : 1; }
+        static constexpr uint16_t record_tag(const char * const name) { return record_fold(record_hash(name)); }
+
+        // Copy the current settings as M500 would store them into 'image' (datasize() bytes), without writing
+        static void stage_image(uint8_t * const image);
+
+        // Where the settings start in the persistent store
+        static int store_offset();
+      #endif
+
       #if ENABLED(AUTO_BED_LEVELING_UBL) // Eventually make these available if any leveling system
                                          // That can store is enabled
         static uint16_t meshes_start_index();
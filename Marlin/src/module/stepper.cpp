@@ -106,6 +106,10 @@ Stepper stepper; // Singleton
   #include "../feature/babystep.h"
 #endif
 
+#if ENABLED(STEPPER_ISR_TIMING)
+  #include "../feature/isr_timing.h"
+#endif
+
 #if MB(ALLIGATOR)
   #include "../feature/dac/dac_dac084s085.h"
 #endif
@@ -185,6 +189,13 @@ TERN(ADAPTIVE_STEP_SMOOTHING,,constexpr) uint8_t Stepper::oversampling_factor;
 xyze_long_t Stepper::delta_error{0};
 
 xyze_ulong_t Stepper::advance_dividend{0};
+#if ENABLED(BRESENHAM_SWAR)
+  bresenham_swar_t Stepper::bresenham;
+#endif
+#if ENABLED(NATIVE_ARCS)
+  bool Stepper::arc_active; // = false
+  arc_tracer_t Stepper::arc;
+#endif
 uint32_t Stepper::advance_divisor = 0,
          Stepper::step_events_completed = 0, // The number of step events executed in the current block
          Stepper::accelerate_until,          // The count at which to stop accelerating
@@ -236,6 +247,12 @@ int32_t Stepper::ticks_nominal = -1;
   uint32_t Stepper::acc_step_rate; // needed for deceleration start point
 #endif
 
+#if ENABLED(STEPPER_BLOCK_PREP)
+  Stepper::block_prep_t Stepper::block_prep[STEPPER_BLOCK_PREP_AHEAD];
+  hal_timer_t Stepper::block_start_max; // = 0
+  uint32_t Stepper::blocks_started, Stepper::blocks_prepared;
+#endif
+
 xyz_long_t Stepper::endstops_trigsteps;
 xyze_long_t Stepper::count_position{0};
 xyze_int8_t Stepper::count_direction{0};
@@ -429,12 +446,27 @@ xyze_int8_t Stepper::count_direction{0};
 
 #define USING_TIMED_PULSE() hal_timer_t start_pulse_count = 0
 #define START_TIMED_PULSE(DIR) (start_pulse_count = HAL_timer_get_count(PULSE_TIMER_NUM))
-#define AWAIT_TIMED_PULSE(DIR) while (PULSE_##DIR##_TICK_COUNT > HAL_timer_get_count(PULSE_TIMER_NUM) - start_pulse_count) { }
+#if ENABLED(MOTION_BENCHMARK)
+  // Virtual time stands still in the ISR, so a pulse takes no time
+  #define AWAIT_TIMED_PULSE(DIR) UNUSED(start_pulse_count)
+#else
+  #define AWAIT_TIMED_PULSE(DIR) while (PULSE_##DIR##_TICK_COUNT > HAL_timer_get_count(PULSE_TIMER_NUM) - start_pulse_count) { }
+#endif
 #define START_HIGH_PULSE()  START_TIMED_PULSE(HIGH)
 #define AWAIT_HIGH_PULSE()  AWAIT_TIMED_PULSE(HIGH)
 #define START_LOW_PULSE()   START_TIMED_PULSE(LOW)
 #define AWAIT_LOW_PULSE()   AWAIT_TIMED_PULSE(LOW)
 
+// Phase timing hook for the LINUX HAL motion benchmark
+#ifndef MOTION_BENCH_PHASE
+  #define MOTION_BENCH_PHASE(P, F) F
+#endif
+
+// Phase timing hook for STEPPER_ISR_TIMING
+#ifndef ISR_TIMING_PHASE
+  #define ISR_TIMING_PHASE(P, F) F
+#endif
+
 #if MINIMUM_STEPPER_PRE_DIR_DELAY > 0
   #define DIR_WAIT_BEFORE() DELAY_NS(MINIMUM_STEPPER_PRE_DIR_DELAY)
 #else
@@ -1254,13 +1286,19 @@ void Stepper::set_directions() {
   #else
 
     // For all the other 32bit CPUs
-    FORCE_INLINE void Stepper::_calc_bezier_curve_coeffs(const int32_t v0, const int32_t v1, const uint32_t av) {
+    FORCE_INLINE void Stepper::_calc_bezier_curve_coeffs(const int32_t v0, const int32_t v1, const uint32_t av,
+      int32_t &A, int32_t &B, int32_t &C, uint32_t &F, uint32_t &AV
+    ) {
       // Calculate the Bézier coefficients
-      bezier_A =  768 * (v1 - v0);
-      bezier_B = 1920 * (v0 - v1);
-      bezier_C = 1280 * (v1 - v0);
-      bezier_F =  128 * v0;
-      bezier_AV = av;
+      A =  768 * (v1 - v0);
+      B = 1920 * (v0 - v1);
+      C = 1280 * (v1 - v0);
+      F =  128 * v0;
+      AV = av;
+    }
+
+    FORCE_INLINE void Stepper::_calc_bezier_curve_coeffs(const int32_t v0, const int32_t v1, const uint32_t av) {
+      _calc_bezier_curve_coeffs(v0, v1, av, bezier_A, bezier_B, bezier_C, bezier_F, bezier_AV);
     }
 
     FORCE_INLINE int32_t Stepper::_eval_bezier_curve(const uint32_t curr_step) {
@@ -1355,6 +1393,14 @@ void Stepper::isr() {
 
   static uint32_t nextMainISR = 0;  // Interval until the next main Stepper Pulse phase (0 = Now)
 
+  TERN_(MOTION_BENCHMARK, MotionBenchmark::isr_calls++);
+
+  #if ENABLED(STEPPER_ISR_TIMING)
+    // The timer count is the time since this ISR was due
+    const hal_timer_t isr_start = IsrTiming::now();
+    IsrTiming::record(ISR_TIMING_LATENCY, isr_start);
+  #endif
+
   #ifndef __AVR__
     // Disable interrupts, to avoid ISR preemption while we reprogram the period
     // (AVR enters the ISR with global interrupts disabled, so no need to do it here)
@@ -1370,7 +1416,7 @@ void Stepper::isr() {
   hal_timer_t next_isr_ticks = 0;
 
   // Limit the amount of iterations
-  uint8_t max_loops = 10;
+  uint8_t max_loops = STEPPER_ISR_MAX_LOOPS;
 
   // We need this variable here to be able to use it in the following loop
   hal_timer_t min_ticks;
@@ -1378,20 +1424,20 @@ void Stepper::isr() {
     // Enable ISRs to reduce USART processing latency
     ENABLE_ISRS();
 
-    if (!nextMainISR) pulse_phase_isr();                            // 0 = Do coordinated axes Stepper pulses
+    if (!nextMainISR) MOTION_BENCH_PHASE(pulse, ISR_TIMING_PHASE(PULSE, pulse_phase_isr())); // 0 = Do coordinated axes Stepper pulses
 
     #if ENABLED(LIN_ADVANCE)
-      if (!nextAdvanceISR) nextAdvanceISR = advance_isr();          // 0 = Do Linear Advance E Stepper pulses
+      if (!nextAdvanceISR) ISR_TIMING_PHASE(ADVANCE, nextAdvanceISR = advance_isr()); // 0 = Do Linear Advance E Stepper pulses
     #endif
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       const bool is_babystep = (nextBabystepISR == 0);              // 0 = Do Babystepping (XY)Z pulses
-      if (is_babystep) nextBabystepISR = babystepping_isr();
+      if (is_babystep) ISR_TIMING_PHASE(BABYSTEP, nextBabystepISR = babystepping_isr());
     #endif
 
     // ^== Time critical. NOTHING besides pulse generation should be above here!!!
 
-    if (!nextMainISR) nextMainISR = block_phase_isr();  // Manage acc/deceleration, get next block
+    if (!nextMainISR) MOTION_BENCH_PHASE(block, ISR_TIMING_PHASE(BLOCK, nextMainISR = block_phase_isr())); // Manage acc/deceleration, get next block
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       if (is_babystep)                                  // Avoid ANY stepping too soon after baby-stepping
@@ -1484,7 +1530,7 @@ void Stepper::isr() {
     /**
      * NB: If for some reason the stepper monopolizes the MPU, eventually the
      * timer will wrap around (and so will 'next_isr_ticks'). So, limit the
-     * loop to 10 iterations. Beyond that, there's no way to ensure correct pulse
+     * loop to STEPPER_ISR_MAX_LOOPS iterations. Beyond that, there's no way to ensure correct pulse
      * timing, since the MCU isn't fast enough.
      */
     if (!--max_loops) next_isr_ticks = min_ticks;
@@ -1495,6 +1541,11 @@ void Stepper::isr() {
   // Now 'next_isr_ticks' contains the period to the next Stepper ISR - And we are
   // sure that the time has not arrived yet - Warrantied by the scheduler
 
+  #if ENABLED(STEPPER_ISR_TIMING)
+    IsrTiming::record_loops(STEPPER_ISR_MAX_LOOPS - max_loops);
+    IsrTiming::record(ISR_TIMING_ISR, IsrTiming::now() - isr_start);
+  #endif
+
   // Set the next ISR to fire at the proper time
   HAL_timer_set_compare(STEP_TIMER_NUM, hal_timer_t(next_isr_ticks));
 
@@ -1680,34 +1731,85 @@ void Stepper::pulse_phase_isr() {
     #endif // DIRECT_STEPPING
 
     if (!is_page) {
-      // Determine if pulses are needed
-      #if HAS_X_STEP
-        PULSE_PREP(X);
-      #endif
-      #if HAS_Y_STEP
-        PULSE_PREP(Y);
-      #endif
-      #if HAS_Z_STEP
-        PULSE_PREP(Z);
-      #endif
+      #if ENABLED(BRESENHAM_SWAR)
 
-      #if EITHER(LIN_ADVANCE, MIXING_EXTRUDER)
-        delta_error.e += advance_dividend.e;
-        if (delta_error.e >= 0) {
-          count_position.e += count_direction.e;
-          #if ENABLED(LIN_ADVANCE)
-            delta_error.e -= advance_divisor;
+        // Determine all the pulses needed at once
+        const uint8_t steps = bresenham.step(advance_divisor);
+
+        #define SWAR_PULSE_PREP(AXIS) do{ \
+          step_needed[_AXIS(AXIS)] = TEST(steps, _AXIS(AXIS)); \
+          if (step_needed[_AXIS(AXIS)]) \
+            count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
+        }while(0)
+
+        #if HAS_X_STEP
+          SWAR_PULSE_PREP(X);
+        #endif
+        #if HAS_Y_STEP
+          SWAR_PULSE_PREP(Y);
+        #endif
+        #if HAS_Z_STEP
+          SWAR_PULSE_PREP(Z);
+        #endif
+
+        #if ENABLED(LIN_ADVANCE)
+          if (TEST(steps, E_AXIS)) {
+            count_position.e += count_direction.e;
             // Don't step E here - But remember the number of steps to perform
             motor_direction(E_AXIS) ? --LA_steps : ++LA_steps;
-          #else
-            step_needed.e = true;
-          #endif
-        }
-      #elif HAS_E0_STEP
-        PULSE_PREP(E);
-      #endif
+          }
+        #elif HAS_E0_STEP
+          SWAR_PULSE_PREP(E);
+        #endif
+
+      #else
+
+        // Determine if pulses are needed
+        #if HAS_X_STEP
+          PULSE_PREP(X);
+        #endif
+        #if HAS_Y_STEP
+          PULSE_PREP(Y);
+        #endif
+        #if HAS_Z_STEP
+          PULSE_PREP(Z);
+        #endif
+
+        #if EITHER(LIN_ADVANCE, MIXING_EXTRUDER)
+          delta_error.e += advance_dividend.e;
+          if (delta_error.e >= 0) {
+            count_position.e += count_direction.e;
+            #if ENABLED(LIN_ADVANCE)
+              delta_error.e -= advance_divisor;
+              // Don't step E here - But remember the number of steps to perform
+              motor_direction(E_AXIS) ? --LA_steps : ++LA_steps;
+            #else
+              step_needed.e = true;
+            #endif
+          }
+        #elif HAS_E0_STEP
+          PULSE_PREP(E);
+        #endif
+
+      #endif // BRESENHAM_SWAR
     }
 
+    #if ENABLED(NATIVE_ARCS)
+      if (arc_active) {
+        // Trace the circle with X and Y, finishing with the block
+        const uint8_t steps = arc.step(step_event_count - step_events_completed + events_to_do);
+
+        #define ARC_PULSE_PREP(AXIS) do{ \
+          step_needed[_AXIS(AXIS)] = TEST(steps, _AXIS(AXIS)); \
+          if (step_needed[_AXIS(AXIS)]) \
+            count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
+        }while(0)
+
+        ARC_PULSE_PREP(X);
+        ARC_PULSE_PREP(Y);
+      }
+    #endif
+
     #if ISR_MULTI_STEPS
       if (firstStep)
         firstStep = false;
@@ -1985,6 +2087,10 @@ uint32_t Stepper::block_phase_isr() {
     // Anything in the buffer?
     if ((current_block = planner.get_current_block())) {
 
+      #if ENABLED(STEPPER_BLOCK_PREP)
+        const hal_timer_t block_start = HAL_timer_get_count(STEP_TIMER_NUM);
+      #endif
+
       // Sync block? Sync the stepper counts and return
       while (TEST(current_block->flag, BLOCK_BIT_SYNC_POSITION)) {
         _set_position(current_block->position);
@@ -2096,22 +2202,34 @@ uint32_t Stepper::block_phase_isr() {
       // No acceleration / deceleration time elapsed so far
       acceleration_time = deceleration_time = 0;
 
-      #if ENABLED(ADAPTIVE_STEP_SMOOTHING)
-        uint8_t oversampling = 0;                           // Assume no axis smoothing (via oversampling)
-        // Decide if axis smoothing is possible
-        uint32_t max_rate = current_block->nominal_rate;    // Get the step event rate
-        while (max_rate < MIN_STEP_ISR_FREQUENCY) {         // As long as more ISRs are possible...
-          max_rate <<= 1;                                   // Try to double the rate
-          if (max_rate < MIN_STEP_ISR_FREQUENCY)            // Don't exceed the estimated ISR limit
-            ++oversampling;                                 // Increase the oversampling (used for left-shift)
+      #if ENABLED(STEPPER_BLOCK_PREP)
+        // Use the start state from prepare_blocks(), if any
+        const block_prep_t * const prep = TEST(current_block->flag, BLOCK_BIT_PREPARED) ? &prep_record(current_block) : nullptr;
+        blocks_started++;
+        if (prep) {
+          blocks_prepared++;
+          TERN_(ADAPTIVE_STEP_SMOOTHING, oversampling_factor = prep->oversampling);
+          step_event_count = prep->step_event_count;
+          accelerate_until = prep->accelerate_until;
+          decelerate_after = prep->decelerate_after;
         }
-        oversampling_factor = oversampling;                 // For all timer interval calculations
-      #else
-        constexpr uint8_t oversampling = 0;
+        else
       #endif
+      {
+        #if ENABLED(ADAPTIVE_STEP_SMOOTHING)
+          const uint8_t oversampling = calc_oversampling(current_block->nominal_rate);
+          oversampling_factor = oversampling;               // For all timer interval calculations
+        #else
+          constexpr uint8_t oversampling = 0;
+        #endif
 
-      // Based on the oversampling factor, do the calculations
-      step_event_count = current_block->step_event_count << oversampling;
+        // Based on the oversampling factor, do the calculations
+        step_event_count = current_block->step_event_count << oversampling;
+
+        // Compute the acceleration and deceleration points
+        accelerate_until = current_block->accelerate_until << oversampling;
+        decelerate_after = current_block->decelerate_after << oversampling;
+      }
 
       // Initialize Bresenham delta errors to 1/2
       delta_error = -int32_t(step_event_count);
@@ -2120,13 +2238,19 @@ uint32_t Stepper::block_phase_isr() {
       advance_dividend = current_block->steps << 1;
       advance_divisor = step_event_count << 1;
 
+      #if ENABLED(NATIVE_ARCS)
+        // Trace the circle in place of the X and Y lines
+        if ((arc_active = TEST(current_block->flag, BLOCK_BIT_ARC))) {
+          arc.init(current_block->arc, oversampling_factor);
+          advance_dividend.x = advance_dividend.y = 0;
+        }
+      #endif
+
+      TERN_(BRESENHAM_SWAR, bresenham.init(advance_dividend, delta_error.x));
+
       // No step events completed so far
       step_events_completed = 0;
 
-      // Compute the acceleration and deceleration points
-      accelerate_until = current_block->accelerate_until << oversampling;
-      decelerate_after = current_block->decelerate_after << oversampling;
-
       #if ENABLED(MIXING_EXTRUDER)
         MIXER_STEPPER_SETUP();
       #endif
@@ -2215,8 +2339,6 @@ uint32_t Stepper::block_phase_isr() {
       ticks_nominal = -1;
 
       #if ENABLED(S_CURVE_ACCELERATION)
-        // Initialize the Bézier speed curve
-        _calc_bezier_curve_coeffs(current_block->initial_rate, current_block->cruise_rate, current_block->acceleration_time_inverse);
         // We haven't started the 2nd half of the trapezoid
         bezier_2nd_half = false;
       #else
@@ -2224,8 +2346,31 @@ uint32_t Stepper::block_phase_isr() {
         acc_step_rate = current_block->initial_rate;
       #endif
 
-      // Calculate the initial timer interval
-      interval = calc_timer_interval(current_block->initial_rate, &steps_per_isr);
+      #if ENABLED(STEPPER_BLOCK_PREP)
+        if (prep) {
+          #if ENABLED(S_CURVE_ACCELERATION)
+            bezier_A = prep->bezier_A;
+            bezier_B = prep->bezier_B;
+            bezier_C = prep->bezier_C;
+            bezier_F = prep->bezier_F;
+            bezier_AV = prep->bezier_AV;
+          #endif
+          steps_per_isr = prep->steps_per_isr;
+          interval = prep->interval;
+        }
+        else
+      #endif
+      {
+        // Initialize the Bézier speed curve
+        TERN_(S_CURVE_ACCELERATION, _calc_bezier_curve_coeffs(current_block->initial_rate, current_block->cruise_rate, current_block->acceleration_time_inverse));
+
+        // Calculate the initial timer interval
+        interval = calc_timer_interval(current_block->initial_rate, &steps_per_isr);
+      }
+
+      #if ENABLED(STEPPER_BLOCK_PREP)
+        NOLESS(block_start_max, hal_timer_t(HAL_timer_get_count(STEP_TIMER_NUM) - block_start));
+      #endif
     }
     #if ENABLED(LASER_POWER_INLINE_CONTINUOUS)
       else { // No new block found; so apply inline laser parameters
@@ -2381,6 +2526,64 @@ bool Stepper::is_block_busy(const block_t* const block) {
   return block == vnew;
 }
 
+#if ENABLED(STEPPER_BLOCK_PREP)
+
+  /**
+   * Work out the start state of the next blocks for block_phase_isr(),
+   * which would otherwise do it in the ISR as each block starts.
+   *
+   * Only blocks with a final trapezoid are prepared. If the planner changes
+   * a block later, calculate_trapezoid_for_block() clears BLOCK_BIT_PREPARED
+   * and the block is prepared again on the next call.
+   *
+   * The LIN_ADVANCE rates are not prepared here. The planner already stores
+   * them in the block, so the ISR only copies them.
+   */
+  void Stepper::prepare_blocks() {
+    const uint8_t head = planner.block_buffer_head;
+    uint8_t b = planner.block_buffer_tail;
+    for (uint8_t n = STEPPER_BLOCK_PREP_AHEAD; n && b != head; --n, b = BLOCK_MOD(b + 1)) {
+      block_t * const block = &planner.block_buffer[b];
+
+      // Skip blocks that are prepared, running, not final, or not for the stepper
+      if (block->flag & (BLOCK_FLAG_PREPARED | BLOCK_FLAG_RECALCULATE | BLOCK_FLAG_SYNC_POSITION
+        #if ENABLED(DIRECT_STEPPING)
+          | BLOCK_FLAG_IS_PAGE
+        #endif
+      ) || is_block_busy(block)) continue;
+
+      block_prep_t prep;
+
+      #if ENABLED(ADAPTIVE_STEP_SMOOTHING)
+        const uint8_t oversampling = prep.oversampling = calc_oversampling(block->nominal_rate);
+      #else
+        constexpr uint8_t oversampling = 0;
+      #endif
+
+      prep.step_event_count = block->step_event_count << oversampling;
+      prep.accelerate_until = block->accelerate_until << oversampling;
+      prep.decelerate_after = block->decelerate_after << oversampling;
+
+      #if ENABLED(S_CURVE_ACCELERATION)
+        _calc_bezier_curve_coeffs(block->initial_rate, block->cruise_rate, block->acceleration_time_inverse,
+          prep.bezier_A, prep.bezier_B, prep.bezier_C, prep.bezier_F, prep.bezier_AV
+        );
+      #endif
+
+      prep.interval = calc_timer_interval(block->initial_rate, &prep.steps_per_isr, oversampling);
+
+      // Publish the record unless the ISR has started or discarded the block meanwhile
+      const bool was_enabled = suspend();
+      if (BLOCK_MOD(b - planner.block_buffer_tail) < STEPPER_BLOCK_PREP_AHEAD && !is_block_busy(block)) {
+        prep_record(block) = prep;
+        SBI(block->flag, BLOCK_BIT_PREPARED);
+      }
+      if (was_enabled) wake_up();
+    }
+  }
+
+#endif // STEPPER_BLOCK_PREP
+
 void Stepper::init() {
 
   #if MB(ALLIGATOR)
@@ -2765,7 +2968,10 @@ void Stepper::report_positions() {
   #endif
   #define EXTRA_CYCLES_BABYSTEP (STEP_PULSE_CYCLES - (CYCLES_EATEN_BABYSTEP))
 
-  #if EXTRA_CYCLES_BABYSTEP > 20
+  #if ENABLED(MOTION_BENCHMARK)
+    #define _SAVE_START() NOOP
+    #define _PULSE_WAIT() NOOP  // Virtual time stands still in the ISR
+  #elif EXTRA_CYCLES_BABYSTEP > 20
     #define _SAVE_START() const hal_timer_t pulse_start = HAL_timer_get_count(PULSE_TIMER_NUM)
     #define _PULSE_WAIT() while (EXTRA_CYCLES_BABYSTEP > (uint32_t)(HAL_timer_get_count(PULSE_TIMER_NUM) - pulse_start) * (PULSE_TIMER_PRESCALE)) { /* nada */ }
   #else
@@ -45,6 +45,13 @@
 
 #include "planner.h"
 #include "stepper/indirection.h"
+
+#if ENABLED(BRESENHAM_SWAR)
+  #include "stepper/bresenham.h"
+#endif
+#if ENABLED(NATIVE_ARCS)
+  #include "stepper/arc.h"
+#endif
 #ifdef __AVR__
   #include "speed_lookuptable.h"
 #endif
@@ -194,6 +201,9 @@
 // But the user could be enforcing a minimum time, so the loop time is
 #define ISR_LOOP_CYCLES (ISR_LOOP_BASE_CYCLES + _MAX(MIN_STEPPER_PULSE_CYCLES, MIN_ISR_LOOP_CYCLES))
 
+// Most pulse / block phase loops in one Stepper::isr() call
+#define STEPPER_ISR_MAX_LOOPS 10
+
 // If linear advance is enabled, then it is handled separately
 #if ENABLED(LIN_ADVANCE)
 
@@ -298,6 +308,13 @@ class Stepper {
     // Delta error variables for the Bresenham line tracer
     static xyze_long_t delta_error;
     static xyze_ulong_t advance_dividend;
+    #if ENABLED(BRESENHAM_SWAR)
+      static bresenham_swar_t bresenham;  // The same state, packed for all axes at once
+    #endif
+    #if ENABLED(NATIVE_ARCS)
+      static bool arc_active;             // X and Y follow the circle of the current block
+      static arc_tracer_t arc;            // The midpoint DDA for that circle
+    #endif
     static uint32_t advance_divisor,
                     step_events_completed,  // The number of step events executed in the current block
                     accelerate_until,       // The point from where we need to stop acceleration
@@ -372,6 +389,33 @@ class Stepper {
 
     #endif
 
+    #if ENABLED(STEPPER_BLOCK_PREP)
+
+      // Block start state, worked out ahead of the ISR by prepare_blocks()
+      typedef struct {
+        uint32_t step_event_count,  // Step events, with oversampling
+                 accelerate_until,  // Acceleration end, with oversampling
+                 decelerate_after,  // Deceleration start, with oversampling
+                 interval;          // Initial timer interval
+        uint8_t steps_per_isr;      // Initial steps per ISR call
+        #if ENABLED(ADAPTIVE_STEP_SMOOTHING)
+          uint8_t oversampling;     // Oversampling factor
+        #endif
+        #if ENABLED(S_CURVE_ACCELERATION)
+          int32_t bezier_A, bezier_B, bezier_C;
+          uint32_t bezier_F, bezier_AV;
+        #endif
+      } block_prep_t;
+
+      static block_prep_t block_prep[STEPPER_BLOCK_PREP_AHEAD];
+
+      // Blocks with the same index modulo STEPPER_BLOCK_PREP_AHEAD share a record
+      FORCE_INLINE static block_prep_t& prep_record(const block_t * const block) {
+        return block_prep[uint8_t(block - planner.block_buffer) & (STEPPER_BLOCK_PREP_AHEAD - 1)];
+      }
+
+    #endif
+
   public:
     // Initialize stepper hardware
     static void init();
@@ -419,6 +463,15 @@ class Stepper {
     // Check if the given block is busy or not - Must not be called from ISR contexts
     static bool is_block_busy(const block_t* const block);
 
+    #if ENABLED(STEPPER_BLOCK_PREP)
+      static hal_timer_t block_start_max;         // Longest block start in the ISR, in stepper timer ticks
+      static uint32_t blocks_started,             // Blocks started by the ISR
+                      blocks_prepared;            // ...of which had a prepared record
+
+      // Prepare the start state of the next blocks - Call from the main loop
+      static void prepare_blocks();
+    #endif
+
     // Get the position of a stepper, in steps
     static int32_t position(const AxisEnum axis);
 
@@ -522,11 +575,25 @@ class Stepper {
     static void _set_position(const int32_t &a, const int32_t &b, const int32_t &c, const int32_t &e);
     FORCE_INLINE static void _set_position(const abce_long_t &spos) { _set_position(spos.a, spos.b, spos.c, spos.e); }
 
-    FORCE_INLINE static uint32_t calc_timer_interval(uint32_t step_rate, uint8_t* loops) {
+    #if ENABLED(ADAPTIVE_STEP_SMOOTHING)
+      // Get the oversampling factor (log2) for a block with the given step rate
+      FORCE_INLINE static uint8_t calc_oversampling(uint32_t max_rate) {
+        uint8_t oversampling = 0;                           // Assume no axis smoothing (via oversampling)
+        // Decide if axis smoothing is possible
+        while (max_rate < MIN_STEP_ISR_FREQUENCY) {         // As long as more ISRs are possible...
+          max_rate <<= 1;                                   // Try to double the rate
+          if (max_rate < MIN_STEP_ISR_FREQUENCY)            // Don't exceed the estimated ISR limit
+            ++oversampling;                                 // Increase the oversampling (used for left-shift)
+        }
+        return oversampling;
+      }
+    #endif
+
+    FORCE_INLINE static uint32_t calc_timer_interval(uint32_t step_rate, uint8_t* loops, const uint8_t oversampling=oversampling_factor) {
       uint32_t timer;
 
       // Scale the frequency, as requested by the caller
-      step_rate <<= oversampling_factor;
+      step_rate <<= oversampling;
 
       uint8_t multistep = 1;
       #if DISABLED(DISABLE_MULTI_STEPPING)
@@ -584,6 +651,11 @@ class Stepper {
 
     #if ENABLED(S_CURVE_ACCELERATION)
       static void _calc_bezier_curve_coeffs(const int32_t v0, const int32_t v1, const uint32_t av);
+      #ifndef __AVR__
+        static void _calc_bezier_curve_coeffs(const int32_t v0, const int32_t v1, const uint32_t av,
+          int32_t &A, int32_t &B, int32_t &C, uint32_t &F, uint32_t &AV
+        );
+      #endif
       static int32_t _eval_bezier_curve(const uint32_t curr_step);
     #endif
 
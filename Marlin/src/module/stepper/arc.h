@@ -0,0 +1,85 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * stepper/arc.h
+ * Midpoint circle DDA for the stepper pulse phase (NATIVE_ARCS)
+ *
+ * The ideal fast axis coordinate moves by |slow| / r steps per step
+ * event, so it keeps a constant speed along the circle. The slow axis
+ * distance is rounded again from the margins of block_arc_t each time
+ * the fast coordinate changes. Both axes then step toward the ideal
+ * position, or on every event once they would otherwise end up short.
+ */
+
+#include "../planner.h"
+
+struct arc_tracer_t {
+  block_arc_t arc;      // The ideal position on the circle
+  int32_t f, y;         // The fast axis coordinate and slow axis distance actually stepped
+  uint32_t accum,       // Moves the ideal fast axis coordinate along the circle
+           divisor;
+  int8_t fdir;
+
+  // Start a block. With oversampling there are 2^oversampling events per step.
+  FORCE_INLINE void init(const block_arc_t &a, const uint8_t oversampling) {
+    arc = a;
+    f = arc.f;
+    y = arc.y_start;
+    fdir = arc.f_end < arc.f ? -1 : 1;
+    divisor = arc.r << oversampling;
+    accum = divisor >> 1;
+  }
+
+  /**
+   * Advance by one step event, with 'events_left' events in the block
+   * including this one. Return a bit mask of the axes (by AxisEnum)
+   * that take a step, as bresenham_step().
+   */
+  FORCE_INLINE uint8_t step(const uint32_t events_left) {
+    if (arc.f != arc.f_end && (accum += arc.y) >= divisor) {
+      accum -= divisor;
+
+      // Update the rounding margins for the new coordinate
+      const int32_t d = fdir * 2 * arc.f + 1;
+      arc.lo -= d;
+      arc.hi += d;
+      arc.f += fdir;
+
+      // Round the slow axis distance again
+      while (arc.hi < 0) { arc.hi += 2 * arc.y + 2; arc.lo -= 2 * arc.y; arc.y++; }
+      while (arc.lo <= 0 && arc.y) { arc.hi -= 2 * arc.y; arc.lo += 2 * arc.y - 2; arc.y--; }
+    }
+
+    return (toward(f, arc.f, arc.f_end, fdir, events_left) ? _BV(arc.fast) : 0)
+         | (toward(y, arc.y, arc.y_end, arc.ydir, events_left) ? _BV(arc.fast ^ 1) : 0);
+  }
+
+  // Step toward the ideal position, or every time if the axis would end up short
+  static FORCE_INLINE bool toward(int32_t &pos, const int32_t ideal, const int32_t end, const int8_t dir, const uint32_t events_left) {
+    const int32_t left = dir * (end - pos);
+    if (left <= 0 || (dir * (ideal - pos) <= 0 && uint32_t(left) < events_left)) return false;
+    pos += dir;
+    return true;
+  }
+};
@@ -0,0 +1,91 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * stepper/bresenham.h
+ * Multi-axis Bresenham kernels for the stepper pulse phase
+ *
+ * Each step event adds twice the axis steps to the axis error and, once
+ * the error is no longer negative, takes a step and subtracts twice the
+ * block step event count. With step_event_count < 2^30 the error always
+ * stays in [-divisor, divisor).
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+/**
+ * Scalar reference: one axis at a time, as in Stepper::pulse_phase_isr()
+ * Return a bit mask of the axes (by AxisEnum) that take a step.
+ */
+FORCE_INLINE uint8_t bresenham_step(xyze_long_t &error, const xyze_ulong_t &dividend, const uint32_t divisor) {
+  uint8_t steps = 0;
+  LOOP_XYZE(i) {
+    error[i] += dividend[i];
+    if (error[i] >= 0) {
+      error[i] -= divisor;
+      SBI(steps, i);
+    }
+  }
+  return steps;
+}
+
+/**
+ * SIMD within a register: two axes per 64-bit word, one per 32-bit lane
+ *
+ * Lanes hold the error biased by 2^31, so they are never negative and an
+ * addition never carries into the next lane. The top bit of a lane is set
+ * when the error is no longer negative, which gives the step mask without
+ * any branches. A mask lane multiplied by the divisor subtracts it from
+ * just the lanes that step.
+ *
+ * The Cortex-M4/M7 DSP extension only has 8 and 16-bit lanes, too narrow
+ * for the error, so this portable form is used on all targets.
+ */
+struct bresenham_swar_t {
+  static constexpr uint64_t LANE_LSB = 0x0000000100000001ULL;
+  static constexpr uint32_t BIAS = _BV32(31);
+
+  uint64_t error[2],    // X | Y << 32, Z | E << 32
+           dividend[2];
+
+  static constexpr uint64_t pack(const uint32_t lo, const uint32_t hi) { return uint64_t(lo) | (uint64_t(hi) << 32); }
+
+  // Start a block with the given dividends and initial error
+  FORCE_INLINE void init(const xyze_ulong_t &div, const int32_t initial_error) {
+    const uint32_t e = BIAS + uint32_t(initial_error);
+    error[0] = error[1] = pack(e, e);
+    dividend[0] = pack(div.x, div.y);
+    dividend[1] = pack(div.z, div.e);
+  }
+
+  // Advance all axes by one step event. Return the step mask, as bresenham_step().
+  FORCE_INLINE uint8_t step(const uint32_t divisor) {
+    error[0] += dividend[0];
+    error[1] += dividend[1];
+    const uint64_t m0 = (error[0] >> 31) & LANE_LSB,
+                   m1 = (error[1] >> 31) & LANE_LSB;
+    error[0] -= m0 * divisor;
+    error[1] -= m1 * divisor;
+    return uint8_t(m0 | (m0 >> 31) | (m1 << 2) | (m1 >> 29));
+  }
+};
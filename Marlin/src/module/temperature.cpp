@@ -127,6 +127,58 @@
   #endif
 #endif
 
+#if ENABLED(THERMISTOR_INDEXED_LOOKUP)
+  // Lookup indexes for the tables in use, built at compile time
+  #define _TT_INDEX(N) static constexpr auto N##_TT_INDEX PROGMEM = TT_INDEX(N##_TEMPTABLE)
+  #if ENABLED(HEATER_0_USES_THERMISTOR)
+    _TT_INDEX(HEATER_0);
+  #endif
+  #if ENABLED(HEATER_1_USES_THERMISTOR)
+    _TT_INDEX(HEATER_1);
+  #endif
+  #if ENABLED(HEATER_2_USES_THERMISTOR)
+    _TT_INDEX(HEATER_2);
+  #endif
+  #if ENABLED(HEATER_3_USES_THERMISTOR)
+    _TT_INDEX(HEATER_3);
+  #endif
+  #if ENABLED(HEATER_4_USES_THERMISTOR)
+    _TT_INDEX(HEATER_4);
+  #endif
+  #if ENABLED(HEATER_5_USES_THERMISTOR)
+    _TT_INDEX(HEATER_5);
+  #endif
+  #if ENABLED(HEATER_6_USES_THERMISTOR)
+    _TT_INDEX(HEATER_6);
+  #endif
+  #if ENABLED(HEATER_7_USES_THERMISTOR)
+    _TT_INDEX(HEATER_7);
+  #endif
+  #if ENABLED(HEATER_BED_USES_THERMISTOR)
+    _TT_INDEX(BED);
+  #endif
+  #if ENABLED(HEATER_CHAMBER_USES_THERMISTOR)
+    _TT_INDEX(CHAMBER);
+  #endif
+  #if ENABLED(PROBE_USES_THERMISTOR)
+    _TT_INDEX(PROBE);
+  #endif
+
+  #if HOTEND_USES_THERMISTOR
+    #define _TT_BUCKETS(N) TERN(HEATER_##N##_USES_THERMISTOR, HEATER_##N##_TT_INDEX.bucket, nullptr)
+    #define _TT_SLOPES(N)  TERN(HEATER_##N##_USES_THERMISTOR, HEATER_##N##_TT_INDEX.slope, nullptr)
+    #if ENABLED(TEMP_SENSOR_1_AS_REDUNDANT)
+      static const uint8_t* const heater_ttbucket_map[2] = { _TT_BUCKETS(0), _TT_BUCKETS(1) };
+      static const int32_t* const heater_ttslope_map[2] = { _TT_SLOPES(0), _TT_SLOPES(1) };
+    #else
+      #define NEXT_TT_BUCKETS(N) ,_TT_BUCKETS(N)
+      #define NEXT_TT_SLOPES(N) ,_TT_SLOPES(N)
+      static const uint8_t* const heater_ttbucket_map[HOTENDS] = ARRAY_BY_HOTENDS(_TT_BUCKETS(0) REPEAT_S(1, HOTENDS, NEXT_TT_BUCKETS));
+      static const int32_t* const heater_ttslope_map[HOTENDS] = ARRAY_BY_HOTENDS(_TT_SLOPES(0) REPEAT_S(1, HOTENDS, NEXT_TT_SLOPES));
+    #endif
+  #endif
+#endif
+
 Temperature thermalManager;
 
 const char str_t_thermal_runaway[] PROGMEM = STR_T_THERMAL_RUNAWAY,
@@ -1263,6 +1315,25 @@ void Temperature::manage_heater() {
   }                                                                   \
 }while(0)
 
+#if ENABLED(THERMISTOR_INDEXED_LOOKUP)
+  /**
+   * Take the first segment that can hold the 'raw' value from its bucket
+   * in the index, step to the segment that does, then interpolate along
+   * the precomputed slope of that segment.
+   */
+  static inline float lookup_thermistor_table(const temp_entry_t * const tbl, const uint8_t len, const uint8_t * const bucket, const int32_t * const slope, const int raw) {
+    if (raw <= int16_t(pgm_read_word(&tbl[0].value))) return int16_t(pgm_read_word(&tbl[0].celsius));
+    if (raw >= int16_t(pgm_read_word(&tbl[len - 1].value))) return int16_t(pgm_read_word(&tbl[len - 1].celsius));
+    uint8_t m = pgm_read_byte(&bucket[raw >> TT_INDEX_SHIFT]);
+    while (raw > int16_t(pgm_read_word(&tbl[m].value))) m++;
+    const int16_t v0 = pgm_read_word(&tbl[m - 1].value), c0 = pgm_read_word(&tbl[m - 1].celsius);
+    return c0 + int32_t(raw - v0) * int32_t(pgm_read_dword(&slope[m])) * (1.0f / 0x10000);
+  }
+  #define LOOKUP_THERMISTOR_TABLE(N) return lookup_thermistor_table(N##_TEMPTABLE, N##_TEMPTABLE_LEN, N##_TT_INDEX.bucket, N##_TT_INDEX.slope, raw)
+#else
+  #define LOOKUP_THERMISTOR_TABLE(N) SCAN_THERMISTOR_TABLE(N##_TEMPTABLE, N##_TEMPTABLE_LEN)
+#endif
+
 #if HAS_USER_THERMISTORS
 
   user_thermistor_t Temperature::user_thermistor[USER_THERMISTORS]; // Initialized by settings.load()
@@ -1335,6 +1406,92 @@ void Temperature::manage_heater() {
     SERIAL_EOL();
   }
 
+  // Steinhart-Hart conversion with the pre-calculated values
+  static float user_thermistor_formula(const user_thermistor_t &t, const int raw) {
+    // maximum adc value .. take into account the over sampling
+    const int adc_max = MAX_RAW_THERMISTOR_VALUE,
+              adc_raw = constrain(raw, 1, adc_max - 1); // constrain to prevent divide-by-zero
+
+    const float adc_inverse = (adc_max - adc_raw) - 0.5f,
+                resistance = t.series_res * (adc_raw + 0.5f) / adc_inverse,
+                log_resistance = logf(resistance);
+
+    float value = t.sh_alpha;
+    value += log_resistance * t.beta_recip;
+    if (t.sh_c_coeff != 0)
+      value += t.sh_c_coeff * cu(log_resistance);
+    value = 1.0f / value;
+
+    // Return degrees C (up to 999, as the LCD only displays 3 digits)
+    return _MIN(value + THERMISTOR_ABS_ZERO_C, 999);
+  }
+
+  #ifdef USER_THERMISTOR_TABLE
+
+    #define USER_THERMISTOR_TABLE_HOT   500   // (°C) Hottest point in the table
+    #define USER_THERMISTOR_TABLE_ERROR 0.25f // (°C) Largest interpolation error between points
+
+    typedef struct { int16_t value; float celsius, slope; } user_thermistor_point_t;
+
+    static user_thermistor_point_t user_thermistor_table[USER_THERMISTORS][USER_THERMISTOR_TABLE];
+    static uint8_t user_thermistor_points[USER_THERMISTORS];
+
+    /**
+     * Sample the formula from USER_THERMISTOR_TABLE_HOT downward, placing each
+     * point as far from the last as the error between them allows. Readings
+     * beyond the last point fall back to the formula.
+     */
+    static void build_user_thermistor_table(const uint8_t t_index, const user_thermistor_t &t) {
+      constexpr int16_t raw_max = MAX_RAW_THERMISTOR_VALUE - 1;
+      user_thermistor_point_t * const p = user_thermistor_table[t_index];
+
+      // Find the first raw value at or below the hottest point
+      auto in_range = [&](const int16_t raw) {
+        const float c = user_thermistor_formula(t, raw);
+        return c > THERMISTOR_ABS_ZERO_C && c <= USER_THERMISTOR_TABLE_HOT;
+      };
+      int16_t lo = 1, hi = raw_max;
+      if (!in_range(hi)) { user_thermistor_points[t_index] = 0; return; }
+      if (in_range(lo)) hi = lo;
+      while (hi - lo > 1) {
+        const int16_t m = (lo + hi) >> 1;
+        if (in_range(m)) hi = m; else lo = m;
+      }
+
+      p[0].value = hi;
+      p[0].celsius = user_thermistor_formula(t, hi);
+      uint8_t n = 1;
+      int16_t step = 2;
+      while (n < USER_THERMISTOR_TABLE && p[n - 1].value < raw_max) {
+        const int16_t v0 = p[n - 1].value;
+        const float c0 = p[n - 1].celsius;
+        int16_t v1, next_step;
+        float c1;
+        for (;;) {
+          v1 = _MIN(v0 + step, raw_max);
+          step = v1 - v0;
+          c1 = user_thermistor_formula(t, v1);
+          const int16_t vm = (v0 + v1) >> 1;
+          const float err = vm > v0 ? ABS(c0 + (c1 - c0) * (vm - v0) / step - user_thermistor_formula(t, vm)) : 0;
+          // The error grows with the square of the step
+          next_step = err < (USER_THERMISTOR_TABLE_ERROR) / 16
+            ? _MIN(step * 2, raw_max)
+            : _MAX(1, int16_t(step * 0.95f * SQRT((USER_THERMISTOR_TABLE_ERROR) / err)));
+          if (err <= USER_THERMISTOR_TABLE_ERROR) break;
+          step = _MIN(next_step, step - 1);
+        }
+        p[n - 1].slope = (c1 - c0) / step;
+        p[n].value = v1;
+        p[n].celsius = c1;
+        p[n].slope = 0;
+        n++;
+        step = next_step;
+      }
+      user_thermistor_points[t_index] = n;
+    }
+
+  #endif // USER_THERMISTOR_TABLE
+
   float Temperature::user_thermistor_to_deg_c(const uint8_t t_index, const int raw) {
     //#if (MOTHERBOARD == BOARD_RAMPS_14_EFB)
     //  static uint32_t clocks_total = 0;
@@ -1352,21 +1509,24 @@ void Temperature::manage_heater() {
       t.beta_recip   = 1.0f / t.beta;
       t.sh_alpha     = RECIPROCAL(THERMISTOR_RESISTANCE_NOMINAL_C - (THERMISTOR_ABS_ZERO_C))
                         - (t.beta_recip * t.res_25_log) - (t.sh_c_coeff * cu(t.res_25_log));
+      #ifdef USER_THERMISTOR_TABLE
+        build_user_thermistor_table(t_index, t);
+      #endif
     }
 
-    // maximum adc value .. take into account the over sampling
-    const int adc_max = MAX_RAW_THERMISTOR_VALUE,
-              adc_raw = constrain(raw, 1, adc_max - 1); // constrain to prevent divide-by-zero
-
-    const float adc_inverse = (adc_max - adc_raw) - 0.5f,
-                resistance = t.series_res * (adc_raw + 0.5f) / adc_inverse,
-                log_resistance = logf(resistance);
-
-    float value = t.sh_alpha;
-    value += log_resistance * t.beta_recip;
-    if (t.sh_c_coeff != 0)
-      value += t.sh_c_coeff * cu(log_resistance);
-    value = 1.0f / value;
+    #ifdef USER_THERMISTOR_TABLE
+      // Interpolate between the two points around the raw value
+      const user_thermistor_point_t * const p = user_thermistor_table[t_index];
+      const uint8_t n = user_thermistor_points[t_index];
+      if (n > 1 && WITHIN(raw, p[0].value, p[n - 1].value)) {
+        uint8_t l = 0, r = n - 1;
+        while (r - l > 1) {
+          const uint8_t m = (l + r) >> 1;
+          if (raw < p[m].value) r = m; else l = m;
+        }
+        return p[l].celsius + (raw - p[l].value) * p[l].slope;
+      }
+    #endif
 
     //#if (MOTHERBOARD == BOARD_RAMPS_14_EFB)
     //  int32_t clocks = TCNT5 - tcnt5;
@@ -1376,8 +1536,7 @@ void Temperature::manage_heater() {
     //  }
     //#endif
 
-    // Return degrees C (up to 999, as the LCD only displays 3 digits)
-    return _MIN(value + THERMISTOR_ABS_ZERO_C, 999);
+    return user_thermistor_formula(t, raw);
   }
 #endif
 
@@ -1489,8 +1648,12 @@ void Temperature::manage_heater() {
 
     #if HOTEND_USES_THERMISTOR
       // Thermistor with conversion table?
-      const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
-      SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
+      #if ENABLED(THERMISTOR_INDEXED_LOOKUP)
+        return lookup_thermistor_table(heater_ttbl_map[e], heater_ttbllen_map[e], heater_ttbucket_map[e], heater_ttslope_map[e], raw);
+      #else
+        const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
+        SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
+      #endif
     #endif
 
     return 0;
@@ -1504,7 +1667,7 @@ void Temperature::manage_heater() {
     #if ENABLED(HEATER_BED_USER_THERMISTOR)
       return user_thermistor_to_deg_c(CTI_BED, raw);
     #elif ENABLED(HEATER_BED_USES_THERMISTOR)
-      SCAN_THERMISTOR_TABLE(BED_TEMPTABLE, BED_TEMPTABLE_LEN);
+      LOOKUP_THERMISTOR_TABLE(BED);
     #elif ENABLED(HEATER_BED_USES_AD595)
       return TEMP_AD595(raw);
     #elif ENABLED(HEATER_BED_USES_AD8495)
@@ -1523,7 +1686,7 @@ void Temperature::manage_heater() {
     #if ENABLED(HEATER_CHAMBER_USER_THERMISTOR)
       return user_thermistor_to_deg_c(CTI_CHAMBER, raw);
     #elif ENABLED(HEATER_CHAMBER_USES_THERMISTOR)
-      SCAN_THERMISTOR_TABLE(CHAMBER_TEMPTABLE, CHAMBER_TEMPTABLE_LEN);
+      LOOKUP_THERMISTOR_TABLE(CHAMBER);
     #elif ENABLED(HEATER_CHAMBER_USES_AD595)
       return TEMP_AD595(raw);
     #elif ENABLED(HEATER_CHAMBER_USES_AD8495)
@@ -1542,7 +1705,7 @@ void Temperature::manage_heater() {
     #if ENABLED(PROBE_USER_THERMISTOR)
       return user_thermistor_to_deg_c(CTI_PROBE, raw);
     #elif ENABLED(PROBE_USES_THERMISTOR)
-      SCAN_THERMISTOR_TABLE(PROBE_TEMPTABLE, PROBE_TEMPTABLE_LEN);
+      LOOKUP_THERMISTOR_TABLE(PROBE);
     #elif ENABLED(PROBE_USES_AD595)
       return TEMP_AD595(raw);
     #elif ENABLED(PROBE_USES_AD8495)
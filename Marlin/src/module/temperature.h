@@ -451,6 +451,7 @@ class Temperature {
         //if (!WITHIN(t_index, 0, USER_THERMISTORS - 1)) return false;
         if (!WITHIN(value, 1, 1000000)) return false;
         user_thermistor[t_index].series_res = value;
+        user_thermistor[t_index].pre_calc = true;
         return true;
       }
       static bool set_res25(int8_t t_index, float value) {
@@ -24,7 +24,7 @@
 #define OVM(V) OV((V)*(0.327/0.327))
 
 // R25 = 100 kOhm, beta25 = 4092 K, 4.7 kOhm pull-up, bed thermistor
-const temp_entry_t temptable_332[] PROGMEM = {
+constexpr temp_entry_t temptable_332[] PROGMEM = {
   { OVM( 268), 150 },
   { OVM( 293), 145 },
   { OVM( 320), 141 },
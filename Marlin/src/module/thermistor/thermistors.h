@@ -187,7 +187,7 @@ typedef struct { int16_t value, celsius; } temp_entry_t;
   #include "thermistor_999.h"
 #endif
 #if ANY_THERMISTOR_IS(1000) // Custom
-  const temp_entry_t temptable_1000[] PROGMEM = { { 0, 0 } };
+  constexpr temp_entry_t temptable_1000[] PROGMEM = { { 0, 0 } };
 #endif
 
 #define _TT_NAME(_N) temptable_ ## _N
@@ -312,6 +312,58 @@ static_assert(
   "Temperature conversion tables over 255 entries need special consideration."
 );
 
+#if ENABLED(THERMISTOR_INDEXED_LOOKUP)
+
+  /**
+   * Indexed table lookup
+   *
+   * The raw range is split into equal buckets of 2^TT_INDEX_SHIFT values.
+   * For each bucket the index holds the first table segment that reaches into
+   * it, and for each segment the slope in Q16 °C per raw unit. Both are built
+   * at compile time from the tables above, so a lookup is a shift and index,
+   * a step over the few segments inside the bucket, and a multiply-add.
+   */
+  #define TT_INDEX_BITS 6 // Buckets over the full raw range, as a power of 2
+
+  constexpr uint8_t tt_bits(const uint32_t n) { return n ? 1 + tt_bits(n >> 1) : 0; }
+  constexpr uint8_t TT_INDEX_SHIFT = tt_bits(MAX_RAW_THERMISTOR_VALUE) - (TT_INDEX_BITS);
+
+  template<uint8_t BUCKETS, uint8_t LEN>
+  struct tt_index_t {
+    uint8_t bucket[BUCKETS];  // First segment ending at or above the start of each bucket
+    int32_t slope[LEN];       // Q16 slope of the segment ending at each entry
+  };
+
+  template<int...> struct tt_seq {};
+  template<int N, int... I> struct tt_make_seq : tt_make_seq<N - 1, N - 1, I...> {};
+  template<int... I> struct tt_make_seq<0, I...> { typedef tt_seq<I...> type; };
+
+  // Segment m runs from entry m-1 to entry m
+  constexpr uint8_t tt_segment(const temp_entry_t * const t, const uint8_t len, const int32_t raw, const uint8_t m=1) {
+    return (m + 1 >= len || t[m].value >= raw) ? m : tt_segment(t, len, raw, m + 1);
+  }
+
+  constexpr int32_t tt_slope_round(const int32_t dc, const int32_t dv) {
+    return (dc + (dc < 0 ? -dv : dv) / 2) / dv;
+  }
+
+  constexpr int32_t tt_slope(const temp_entry_t * const t, const uint8_t m) {
+    return (m && t[m].value > t[m - 1].value)
+      ? tt_slope_round(int32_t(t[m].celsius - t[m - 1].celsius) * 0x10000L, t[m].value - t[m - 1].value)
+      : 0;
+  }
+
+  template<uint8_t BUCKETS, uint8_t LEN, int... B, int... S>
+  constexpr tt_index_t<BUCKETS, LEN> tt_build_index(const temp_entry_t * const t, tt_seq<B...>, tt_seq<S...>) {
+    return { { tt_segment(t, LEN, int32_t(B) << TT_INDEX_SHIFT)... }, { tt_slope(t, S)... } };
+  }
+
+  // Enough buckets to reach the last table entry
+  #define TT_INDEX_BUCKETS(TBL) ((TBL[COUNT(TBL) - 1].value >> TT_INDEX_SHIFT) + 1)
+  #define TT_INDEX(TBL) tt_build_index<TT_INDEX_BUCKETS(TBL), COUNT(TBL)>(TBL, tt_make_seq<TT_INDEX_BUCKETS(TBL)>::type(), tt_make_seq<COUNT(TBL)>::type())
+
+#endif
+
 // Set the high and low raw values for the heaters
 // For thermistors the highest temperature results in the lowest ADC value
 // For thermocouples the highest temperature results in the highest ADC value
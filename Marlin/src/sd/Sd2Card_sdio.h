@@ -34,6 +34,17 @@ class Sd2Card {
     bool init(uint8_t sckRateID = 0, uint8_t chipSelectPin = 0) { return SDIO_Init(); }
     bool readBlock(uint32_t block, uint8_t *dst) { return SDIO_ReadBlock(block, dst); }
     bool writeBlock(uint32_t block, const uint8_t *src) { return SDIO_WriteBlock(block, src); }
+
+    // Multiple-block reads and writes, one block at a time
+    bool readStart(const uint32_t block) { pos = block; return true; }
+    bool readData(uint8_t *dst) { return SDIO_ReadBlock(pos++, dst); }
+    bool readStop() { return true; }
+    bool writeStart(const uint32_t block, const uint32_t) { pos = block; return true; }
+    bool writeData(const uint8_t *src) { return SDIO_WriteBlock(pos++, src); }
+    bool writeStop() { return true; }
+
+  private:
+    uint32_t pos;
 };
 
 #endif // SDIO_SUPPORT
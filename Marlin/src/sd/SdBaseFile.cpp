@@ -1033,7 +1033,7 @@ int16_t SdBaseFile::read(void* buf, uint16_t nbyte) {
         // start of new cluster
         if (curPosition_ == 0)
           curCluster_ = firstCluster_;                      // use first cluster in file
-        else if (!vol_->fatGet(curCluster_, &curCluster_))  // get next cluster from FAT
+        else if (!nextCluster())                            // get next cluster from FAT
           return -1;
       }
       block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
@@ -1060,6 +1060,56 @@ int16_t SdBaseFile::read(void* buf, uint16_t nbyte) {
   return nbyte;
 }
 
+/**
+ * Read whole blocks of a file straight into a buffer, bypassing the cache.
+ * The file position must be at the start of a block. Blocks are read from
+ * the current cluster only, with one multiple-block transfer.
+ *
+ * \param[out] dst Pointer to the location that will receive the data.
+ * The last block of the file is read in full.
+ *
+ * \param[in] count Maximum number of blocks to read.
+ *
+ * \return For success readBlocks() returns the number of bytes read,
+ * which is zero at the end of the file. If an error occurs, or the file
+ * position is not at the start of a block, readBlocks() returns -1.
+ */
+int16_t SdBaseFile::readBlocks(uint8_t* dst, uint8_t count) {
+  if (!isFile() || !(flags_ & O_READ) || (curPosition_ & 0x1FF)) return -1;
+  if (curPosition_ >= fileSize_) return 0;
+
+  const uint8_t blockOfCluster = vol_->blockOfCluster(curPosition_);
+  if (blockOfCluster == 0) {
+    // start of new cluster
+    if (curPosition_ == 0)
+      curCluster_ = firstCluster_;                      // use first cluster in file
+    else if (!nextCluster())                            // get next cluster from FAT
+      return -1;
+  }
+  const uint32_t block = vol_->clusterStartBlock(curCluster_) + blockOfCluster,
+                 left = fileSize_ - curPosition_;
+  NOMORE(count, vol_->blocksPerCluster() - blockOfCluster);
+  NOMORE(count, (left + 511) >> 9);
+
+  // The cache may hold a newer copy of one of the blocks
+  const uint32_t cached = vol_->cacheBlockNumber();
+  if (cached >= block && cached < block + count && !vol_->cacheFlush()) return -1;
+
+  if (!vol_->readBlocks(block, dst, count)) return -1;
+
+  const uint16_t n = _MIN(left, uint32_t(count) << 9);
+  curPosition_ += n;
+  return n;
+}
+
+// Move to the next cluster of the file, from the cached runs or the FAT
+bool SdBaseFile::nextCluster() {
+  #ifdef SD_EXTENT_CACHE
+    if (vol_->extentNext(firstCluster_, curCluster_, &curCluster_)) return true;
+  #endif
+  return vol_->fatGet(curCluster_, &curCluster_);
+}
+
 /**
  * Read the next entry in a directory.
  *
@@ -1423,6 +1473,13 @@ bool SdBaseFile::seekSet(const uint32_t pos) {
   nCur = (curPosition_ - 1) >> (vol_->clusterSizeShift_ + 9);
   nNew = (pos - 1) >> (vol_->clusterSizeShift_ + 9);
 
+  #ifdef SD_EXTENT_CACHE
+    if (vol_->extentCluster(firstCluster_, nNew, &curCluster_)) {
+      curPosition_ = pos;
+      return true;
+    }
+  #endif
+
   if (nNew < nCur || curPosition_ == 0)
     curCluster_ = firstCluster_;      // must follow chain from first cluster
   else
@@ -1719,12 +1776,16 @@ int16_t SdBaseFile::write(const void* buf, uint16_t nbyte) {
     // block for data write
     uint32_t block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
     if (n == 512) {
-      // full block - don't need to use cache
-      if (vol_->cacheBlockNumber() == block) {
+      // full blocks - don't need to use cache
+      uint8_t count = _MIN(nToWrite >> 9, vol_->blocksPerCluster() - blockOfCluster);
+      const uint32_t cached = vol_->cacheBlockNumber();
+      if (cached >= block && cached < block + count) {
         // invalidate cache if block is in cache
         vol_->cacheSetBlockNumber(0xFFFFFFFF, false);
       }
-      if (!vol_->writeBlock(block, src)) goto FAIL;
+      // write the rest of the cluster with one transfer
+      if (!vol_->writeBlocks(block, src, count)) goto FAIL;
+      n = uint16_t(count) << 9;
     }
     else {
       if (blockOffset == 0 && curPosition_ >= fileSize_) {
@@ -289,6 +289,15 @@ class SdBaseFile {
   bool getDosName(char * const name);
   void ls(uint8_t flags = 0, uint8_t indent = 0);
 
+  #ifdef SD_EXTENT_CACHE
+    /**
+     * Cache the runs of contiguous clusters in this file, so reads and
+     * seeks don't follow the FAT. One file at a time can be cached.
+     * \return true for success or false for failure.
+     */
+    bool cacheExtents() { return isFile() && vol_->extentBuild(firstCluster_); }
+  #endif
+
   bool mkdir(SdBaseFile* dir, const char* path, bool pFlag = true);
   bool open(SdBaseFile* dirFile, uint16_t index, uint8_t oflag);
   bool open(SdBaseFile* dirFile, const char* path, uint8_t oflag);
@@ -301,6 +310,7 @@ class SdBaseFile {
   bool printName();
   int16_t read();
   int16_t read(void* buf, uint16_t nbyte);
+  int16_t readBlocks(uint8_t* dst, uint8_t count);
   int8_t readDir(dir_t* dir, char* longFilename);
   static bool remove(SdBaseFile* dirFile, const char* path);
   bool remove();
@@ -377,6 +387,7 @@ class SdBaseFile {
   // private functions
   bool addCluster();
   bool addDirCluster();
+  bool nextCluster();
   dir_t* cacheDirEntry(uint8_t action);
   int8_t lsPrintNext(uint8_t flags, uint8_t indent);
   static bool make83Name(const char* str, uint8_t* name, const char** ptr);
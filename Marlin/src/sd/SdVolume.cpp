@@ -157,6 +157,108 @@ bool SdVolume::chainSize(uint32_t cluster, uint32_t* size) {
   return true;
 }
 
+// Read a run of blocks with one multiple-block transfer, or one by one if that fails
+bool SdVolume::readBlocks(uint32_t block, uint8_t* dst, const uint8_t count) {
+  if (count > 1 && sdCard_->readStart(block)) {
+    uint8_t i = 0;
+    while (i < count && sdCard_->readData(dst + (uint16_t(i) << 9))) i++;
+    if (sdCard_->readStop() && i == count) return true;
+  }
+  for (uint8_t i = 0; i < count; i++)
+    if (!readBlock(block + i, dst + (uint16_t(i) << 9))) return false;
+  return true;
+}
+
+// Write a run of blocks with one multiple-block transfer, or one by one if that fails
+bool SdVolume::writeBlocks(uint32_t block, const uint8_t* src, const uint8_t count) {
+  if (count > 1 && sdCard_->writeStart(block, count)) {
+    uint8_t i = 0;
+    while (i < count && sdCard_->writeData(src + (uint16_t(i) << 9))) i++;
+    if (sdCard_->writeStop() && i == count) return true;
+  }
+  for (uint8_t i = 0; i < count; i++)
+    if (!writeBlock(block + i, src + (uint16_t(i) << 9))) return false;
+  return true;
+}
+
+#ifdef SD_EXTENT_CACHE
+
+  /**
+   * Walk a cluster chain once and keep its runs of contiguous clusters, so
+   * the file can be read and seeked without going back to the FAT. A chain
+   * with more runs than SD_EXTENT_CACHE is cached up to the last run that
+   * fits, and followed in the FAT after that.
+   */
+  bool SdVolume::extentBuild(uint32_t firstCluster) {
+    extentChain_ = 0;
+    if (firstCluster < 2) return false;
+    uint8_t n = 0;
+    extent_t *e = extent_;
+    e->index = 0;
+    e->cluster = firstCluster;
+    e->count = 1;
+    for (uint32_t c = firstCluster, next;; c = next) {
+      if (!fatGet(c, &next)) return false;
+      if (isEOC(next)) break;
+      if (next == c + 1)
+        e->count++;
+      else {
+        if (++n >= SD_EXTENT_CACHE) { n--; break; }
+        const uint32_t index = e->index + e->count;
+        e++;
+        e->index = index;
+        e->cluster = next;
+        e->count = 1;
+      }
+    }
+    extentCount_ = n + 1;
+    extentChain_ = firstCluster;
+    return true;
+  }
+
+  // Get the cluster at an index in a chain, starting from the nearest cached run
+  bool SdVolume::extentCluster(uint32_t firstCluster, uint32_t index, uint32_t* cluster) {
+    if (firstCluster != extentChain_) return false;
+    const extent_t *e = extent_;
+    for (uint8_t i = 1; i < extentCount_ && extent_[i].index <= index; i++) e++;
+    if (index < e->index + e->count) {
+      *cluster = e->cluster + (index - e->index);
+      return true;
+    }
+    // Past the cached runs
+    uint32_t c = e->cluster + e->count - 1;
+    for (index -= e->index + e->count - 1; index--;)
+      if (!fatGet(c, &c)) return false;
+    *cluster = c;
+    return true;
+  }
+
+  // Get the cluster after one in a cached chain
+  bool SdVolume::extentNext(uint32_t firstCluster, uint32_t cluster, uint32_t* next) {
+    if (firstCluster != extentChain_) return false;
+    for (uint8_t i = 0; i < extentCount_; i++) {
+      const extent_t &e = extent_[i];
+      if (cluster - e.cluster < e.count) {
+        if (cluster - e.cluster < e.count - 1)
+          *next = cluster + 1;
+        else if (i < extentCount_ - 1)
+          *next = extent_[i + 1].cluster;
+        else
+          return false;                   // End of the cached runs
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Drop the cached chain if a FAT entry in it changes
+  void SdVolume::extentCheck(uint32_t cluster) {
+    for (uint8_t i = 0; extentChain_ && i < extentCount_; i++)
+      if (cluster - extent_[i].cluster < extent_[i].count) extentChain_ = 0;
+  }
+
+#endif // SD_EXTENT_CACHE
+
 // Fetch a FAT entry
 bool SdVolume::fatGet(uint32_t cluster, uint32_t* value) {
   uint32_t lba;
@@ -203,6 +305,10 @@ bool SdVolume::fatPut(uint32_t cluster, uint32_t value) {
   // error if not in FAT
   if (cluster > (clusterCount_ + 1)) return false;
 
+  #ifdef SD_EXTENT_CACHE
+    extentCheck(cluster);
+  #endif
+
   if (FAT12_SUPPORT && fatType_ == 12) {
     uint16_t index = cluster;
     index += index >> 1;
@@ -334,6 +440,9 @@ bool SdVolume::init(Sd2Card* dev, uint8_t part) {
   cacheDirty_ = 0;  // cacheFlush() will write block if true
   cacheMirrorBlock_ = 0;
   cacheBlockNumber_ = 0xFFFFFFFF;
+  #ifdef SD_EXTENT_CACHE
+    extentChain_ = 0;
+  #endif
 
   // if part == 0 assume super floppy with FAT boot sector in block zero
   // if part > 0 assume mbr volume with partition table
@@ -164,6 +164,23 @@ class SdVolume {
   uint16_t rootDirEntryCount_;  // number of entries in FAT16 root dir
   uint32_t rootDirStart_;       // root start block for FAT16, cluster for FAT32
 
+  #ifdef SD_EXTENT_CACHE
+    // Runs of contiguous clusters in one cluster chain
+    struct extent_t {
+      uint32_t index;             // index of the first cluster in the chain
+      uint32_t cluster;           // first cluster of the run
+      uint32_t count;             // clusters in the run
+    };
+    extent_t extent_[SD_EXTENT_CACHE];
+    uint32_t extentChain_;        // first cluster of the cached chain, 0 if none
+    uint8_t extentCount_;         // runs in extent_
+
+    bool extentBuild(uint32_t firstCluster);
+    bool extentCluster(uint32_t firstCluster, uint32_t index, uint32_t* cluster);
+    bool extentNext(uint32_t firstCluster, uint32_t cluster, uint32_t* next);
+    void extentCheck(uint32_t cluster);
+  #endif
+
   bool allocContiguous(uint32_t count, uint32_t* curCluster);
   uint8_t blockOfCluster(uint32_t position) const { return (position >> 9) & (blocksPerCluster_ - 1); }
   uint32_t clusterStartBlock(uint32_t cluster) const { return dataStartBlock_ + ((cluster - 2) << clusterSizeShift_); }
@@ -197,5 +214,7 @@ class SdVolume {
     return  cluster >= FAT32EOC_MIN;
   }
   bool readBlock(uint32_t block, uint8_t* dst) { return sdCard_->readBlock(block, dst); }
+  bool readBlocks(uint32_t block, uint8_t* dst, const uint8_t count);
   bool writeBlock(uint32_t block, const uint8_t* dst) { return sdCard_->writeBlock(block, dst); }
+  bool writeBlocks(uint32_t block, const uint8_t* src, const uint8_t count);
 };
@@ -123,6 +123,11 @@ char CardReader::proc_filenames[SD_PROCEDURE_DEPTH][MAXPATHNAMELENGTH];
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#ifdef SD_READ_AHEAD
+  uint8_t CardReader::ahead_buf[(SD_READ_AHEAD) * 512] __attribute__((aligned(4))); // Word-aligned for SDIO DMA
+  uint32_t CardReader::ahead_pos, CardReader::ahead_end;
+#endif
+
 CardReader::CardReader() {
   #if ENABLED(SDCARD_SORT_ALPHA)
     sort_count = 0;
@@ -455,6 +460,9 @@ void CardReader::manage_media() {
 
 void CardReader::release() {
   endFilePrint();
+  #ifdef POWER_LOSS_JOURNAL
+    recovery.journal_close();
+  #endif
   flag.mounted = false;
   flag.workDirIsRoot = true;
   #if ALL(SDCARD_SORT_ALPHA, SDSORT_USES_RAM, SDSORT_CACHE_NAMES)
@@ -581,7 +589,10 @@ void CardReader::openFileRead(char * const path, const uint8_t subcall_type/*=0*
 
   if (file.open(curDir, fname, O_READ)) {
     filesize = file.fileSize();
-    sdpos = 0;
+    #ifdef SD_EXTENT_CACHE
+      file.cacheExtents();
+    #endif
+    setIndex(0);
 
     PORT_REDIRECT(SERIAL_BOTH);
     SERIAL_ECHOLNPAIR(STR_SD_FILE_OPENED, fname, STR_SD_SIZE, filesize);
@@ -1113,6 +1124,64 @@ uint16_t CardReader::get_num_Files() {
   );
 }
 
+#ifdef SD_READ_AHEAD
+
+  /**
+   * Read whole blocks of the open file into the free part of the ring, as
+   * many as fit before the end of the ring or of the current cluster.
+   * Return false if nothing could be read.
+   */
+  bool CardReader::fill_ahead() {
+    constexpr uint16_t ring = sizeof(ahead_buf);
+    const uint32_t used = ahead_end - (ahead_pos & ~0x1FFUL);
+    if (used >= ring || ahead_end >= filesize) return false;
+    const uint16_t slot = ahead_end % ring;
+    const int16_t n = file.readBlocks(&ahead_buf[slot], _MIN(ring - used, uint32_t(ring - slot)) >> 9);
+    if (n <= 0) return false;
+    ahead_end += n;
+    return true;
+  }
+
+  /**
+   * Get the rest of the current line, up to and including the end-of-line
+   * character, or as much of it as the ring holds in one piece. Like get(),
+   * leave the index on the last character taken.
+   * Return the length, 0 at the end of the file, or -1 on a read error.
+   */
+  int16_t CardReader::get_line(const char* &line) {
+    if (ahead_pos >= ahead_end && !fill_ahead()) {
+      sdpos = ahead_pos;
+      return eof() ? 0 : -1;
+    }
+    const uint16_t start = ahead_pos % sizeof(ahead_buf),
+                   avail = _MIN(ahead_end - ahead_pos, uint32_t(sizeof(ahead_buf) - start));
+    line = (const char*)&ahead_buf[start];
+    uint16_t len = 0;
+    while (len < avail) {
+      const char c = line[len++];
+      if (c == '\n' || c == '\r') break;
+    }
+    ahead_pos += len;
+    sdpos = ahead_pos - 1;
+    return len;
+  }
+
+  int16_t CardReader::read(void* buf, uint16_t nbyte) {
+    if (!file.isOpen()) return -1;
+    uint8_t *dst = (uint8_t*)buf;
+    uint16_t done = 0;
+    while (done < nbyte && (ahead_pos < ahead_end || fill_ahead())) {
+      const uint16_t start = ahead_pos % sizeof(ahead_buf),
+                     n = _MIN(uint32_t(nbyte - done), _MIN(ahead_end - ahead_pos, uint32_t(sizeof(ahead_buf) - start)));
+      memcpy(dst + done, &ahead_buf[start], n);
+      ahead_pos += n;
+      done += n;
+    }
+    return done;
+  }
+
+#endif // SD_READ_AHEAD
+
 //
 // Return from procedure or close out the Print Job
 //
@@ -1180,6 +1249,44 @@ void CardReader::fileHasFinished() {
     }
   }
 
+  #ifdef POWER_LOSS_JOURNAL
+
+    /**
+     * Get the first block of the power-loss journal, a contiguous file of
+     * POWER_LOSS_JOURNAL blocks, or 0 if there is none. With 'create' make
+     * the file, replacing one of another size, and set 'created' since its
+     * blocks still hold old data.
+     */
+    uint32_t CardReader::openJobRecoveryJournal(const bool create, bool &created) {
+      created = false;
+      if (!isMounted()) return 0;
+
+      constexpr uint32_t size = uint32_t(POWER_LOSS_JOURNAL) * 512;
+      SdFile &jfile = recovery.file;
+      uint32_t bgn = 0, end;
+      if (jfile.open(&root, recovery.filename, create ? O_RDWR : O_READ)) {
+        if (jfile.fileSize() != size || !jfile.contiguousRange(&bgn, &end)) bgn = 0;
+        if (bgn || !create) {
+          jfile.close();
+          return bgn;
+        }
+        jfile.remove();
+      }
+      else if (!create)
+        return 0;
+
+      if (jfile.createContiguous(&root, recovery.filename, size) && jfile.contiguousRange(&bgn, &end))
+        created = true;
+      else {
+        SERIAL_ECHOLNPAIR(STR_SD_OPEN_FILE_FAIL, recovery.filename, ".");
+        bgn = 0;
+      }
+      jfile.close();
+      return bgn;
+    }
+
+  #endif
+
 #endif // POWER_LOSS_RECOVERY
 
 #endif // SDSUPPORT
@@ -152,16 +152,28 @@ public:
     static bool jobRecoverFileExists();
     static void openJobRecoveryFile(const bool read);
     static void removeJobRecoveryFile();
+    #ifdef POWER_LOSS_JOURNAL
+      static uint32_t openJobRecoveryJournal(const bool create, bool &created);
+    #endif
   #endif
 
   static inline bool isFileOpen() { return isMounted() && file.isOpen(); }
   static inline uint32_t getIndex() { return sdpos; }
   static inline uint32_t getFileSize() { return filesize; }
   static inline bool eof() { return sdpos >= filesize; }
-  static inline void setIndex(const uint32_t index) { sdpos = index; file.seekSet(index); }
   static inline char* getWorkDirName() { workDir.getDosName(filename); return filename; }
-  static inline int16_t get() { sdpos = file.curPosition(); return (int16_t)file.read(); }
-  static inline int16_t read(void* buf, uint16_t nbyte) { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+  #ifdef SD_READ_AHEAD
+    static inline void setIndex(const uint32_t index) { sdpos = ahead_pos = index; ahead_end = index & ~0x1FFUL; file.seekSet(ahead_end); }
+    static inline int16_t get() { sdpos = ahead_pos; return (ahead_pos < ahead_end || fill_ahead()) ? ahead_buf[ahead_pos++ % sizeof(ahead_buf)] : -1; }
+    static int16_t get_line(const char* &line);
+    static inline void unget(const uint16_t count) { ahead_pos -= count; sdpos = ahead_pos - 1; }
+    static int16_t read(void* buf, uint16_t nbyte);
+    static inline void read_ahead() { if (isPrinting()) (void)fill_ahead(); }
+  #else
+    static inline void setIndex(const uint32_t index) { sdpos = index; file.seekSet(index); }
+    static inline int16_t get() { sdpos = file.curPosition(); return (int16_t)file.read(); }
+    static inline int16_t read(void* buf, uint16_t nbyte) { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+  #endif
   static inline int16_t write(void* buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
 
   static Sd2Card& getSd2Card() { return sd2card; }
@@ -245,6 +257,15 @@ private:
 
   static uint32_t filesize, sdpos;
 
+  //
+  // Read-ahead ring. Holds the file from ahead_pos up to ahead_end.
+  //
+  #ifdef SD_READ_AHEAD
+    static uint8_t ahead_buf[(SD_READ_AHEAD) * 512];
+    static uint32_t ahead_pos, ahead_end;
+    static bool fill_ahead();
+  #endif
+
   //
   // Procedure calls to other files
   //
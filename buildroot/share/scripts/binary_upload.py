@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+#
+# binary_upload.py
+#
+# Upload a file to the SD card with the binary file transfer protocol
+# (BINARY_FILE_TRANSFER, started with 'M28 B1').
+#
+# Usage: binary_upload.py [options] <file> [<name on card>]
+#
+#   --port <dev>      Serial port (needs pyserial)
+#   --baud <rate>     Baud rate (default 115200)
+#   --exec <command>  Run a LINUX HAL build and talk to it over stdin/stdout
+#   --window <n>      Packets to send ahead of the 'ok' (default: as reported)
+#   --size <n>        Largest packet payload (default: as reported)
+#   --compress        Compress with heatshrink (needs heatshrink2)
+#   --dummy           Transfer without writing to the card
+#
+# Firmware with BINARY_STREAM_BUFFERS gives the number of packets that may
+# be sent ahead in its sync reply. Otherwise each packet waits for its 'ok'.
+#
+import argparse, os, queue, shlex, struct, subprocess, sys, threading, time
+
+# Protocols and packet types
+CONTROL, FILE_TRANSFER = 0, 1
+SYNC, CLOSE = 1, 2
+FT_QUERY, FT_OPEN, FT_CLOSE, FT_WRITE, FT_ABORT = range(5)
+
+class Link:
+  "Lines from the firmware in a queue, raw bytes to it"
+  def __init__(self, args):
+    self.verbose = args.verbose
+    if args.exec:
+      self.proc = subprocess.Popen(shlex.split(args.exec), stdin=subprocess.PIPE, stdout=subprocess.PIPE, bufsize=0)
+      self.write, readline = self.proc.stdin.write, self.proc.stdout.readline
+    else:
+      import serial
+      self.proc, port = None, serial.Serial(args.port, args.baud, timeout=1)
+      self.write, readline = port.write, port.readline
+    self.lines = queue.Queue()
+    def read():
+      while True:
+        line = readline()
+        if line: self.lines.put(line.decode('latin-1').strip())
+        elif self.proc: break
+    threading.Thread(target=read, daemon=True).start()
+
+  def get(self, timeout):
+    "The next line, or None after the timeout"
+    try:
+      line = self.lines.get(timeout=timeout)
+    except queue.Empty:
+      return None
+    if self.verbose: print('<', line)
+    return line
+
+  def expect(self, start, timeout=10):
+    "Wait for a line starting with the given string"
+    end = time.time() + timeout
+    while True:
+      line = self.get(max(0, end - time.time()))
+      if line is None: sys.exit('Timed out waiting for ' + start)
+      if line.startswith(start): return line
+
+def fletcher(cs, data):
+  for v in data:
+    low = ((cs & 0xFF) + v) % 255
+    cs = ((((cs >> 8) + low) % 255) << 8) | low
+  return cs
+
+def packet(sync, protocol, ptype, payload=b''):
+  head = struct.pack('<BBH', sync, (protocol << 4) | ptype, len(payload))
+  hcs = struct.pack('<H', fletcher(0, head))
+  footer = struct.pack('<H', fletcher(fletcher(fletcher(0, head), hcs), payload)) if payload else b''
+  return b'\xAD\xB5' + head + hcs + payload + footer
+
+class Stream:
+  "Send packets in order, keeping up to 'window' of them unacknowledged"
+  def __init__(self, link):
+    self.link = link
+    link.write(packet(0, CONTROL, SYNC))
+    reply = link.expect('ss')[2:].split(',')
+    self.sync, self.size = int(reply[0]), int(reply[1])
+    self.window = int(reply[3]) if len(reply) > 3 else 1
+    self.sent = []        # (sync, packet) not yet acknowledged
+    self.replies = []     # Other lines, such as PFT replies
+
+  def send(self, protocol, ptype, payload=b''):
+    while len(self.sent) >= self.window: self.wait()
+    while self.poll(0): pass
+    p = packet(self.sync, protocol, ptype, payload)
+    self.link.write(p)
+    self.sent.append((self.sync, p))
+    self.sync = (self.sync + 1) & 0xFF
+
+  def poll(self, timeout):
+    "Handle one line from the firmware, if there is one"
+    line = self.link.get(timeout)
+    if line is None: return False
+    if line.startswith('fe'): sys.exit('Transfer failed: ' + line)
+    if line[:2] in ('ok', 'rs') and line[2:].isdigit():
+      n = int(line[2:])
+      if line.startswith('ok'):
+        while self.sent and ((n - self.sent[0][0]) & 0xFF) < 0x80: self.sent.pop(0)
+      else:
+        # Send again from the requested packet on
+        self.sent = [s for s in self.sent if ((s[0] - n) & 0xFF) < 0x80]
+        for _, p in self.sent: self.link.write(p)
+    else:
+      self.replies.append(line)
+    return True
+
+  def wait(self, timeout=10):
+    if not self.poll(timeout): sys.exit('Timed out waiting for the firmware')
+
+  def reply(self, start, timeout=10):
+    "Wait for all packets to be acknowledged, then for a reply line"
+    end = time.time() + timeout
+    while True:
+      while self.replies:
+        line = self.replies.pop(0)
+        if line.startswith(start): return line
+      if time.time() > end: sys.exit('Timed out waiting for ' + start)
+      self.poll(0.1)
+
+def upload(args):
+  data = open(args.file, 'rb').read()
+  name = args.name or os.path.basename(args.file)
+  link = Link(args)
+  if args.exec: link.expect('x86_64 Initialized', timeout=30)
+  link.write(b'M28 B1\n')
+  link.expect('echo:Switching to Binary Protocol')
+
+  stream = Stream(link)
+  if args.window: stream.window = args.window
+  size = min(args.size or stream.size, stream.size)
+
+  if args.compress:
+    import heatshrink2
+    stream.send(FILE_TRANSFER, FT_QUERY)
+    window, lookahead = map(int, stream.reply('PFT:version').split(':heatshrink,')[1].split(','))
+    data = heatshrink2.compress(data, window_sz2=window, lookahead_sz2=lookahead)
+
+  stream.send(FILE_TRANSFER, FT_OPEN, bytes([args.dummy, args.compress]) + name.encode() + b'\0')
+  if stream.reply('PFT:') != 'PFT:success': sys.exit('Could not open ' + name)
+  print('Packets of %d bytes, %d ahead' % (size, stream.window))
+
+  start = time.time()
+  for i in range(0, len(data), size):
+    stream.send(FILE_TRANSFER, FT_WRITE, data[i:i + size])
+    if any(r.startswith('PFT:') for r in stream.replies): sys.exit('Write failed: ' + stream.replies[-1])
+  stream.send(FILE_TRANSFER, FT_CLOSE)
+  if stream.reply('PFT:', timeout=60) != 'PFT:success': sys.exit('Could not close ' + name)
+  took = time.time() - start
+
+  stream.send(CONTROL, CLOSE)
+  while stream.sent: stream.wait()
+  print('%d bytes in %.2f s, %.1f KB/s' % (len(data), took, len(data) / took / 1024))
+  if link.proc: link.proc.kill()
+
+if __name__ == '__main__':
+  parser = argparse.ArgumentParser(description='Upload a file with the binary file transfer protocol')
+  parser.add_argument('--port')
+  parser.add_argument('--baud', type=int, default=115200)
+  parser.add_argument('--exec')
+  parser.add_argument('--window', type=int)
+  parser.add_argument('--size', type=int)
+  parser.add_argument('--compress', action='store_true')
+  parser.add_argument('--dummy', action='store_true')
+  parser.add_argument('--verbose', '-v', action='store_true')
+  parser.add_argument('file')
+  parser.add_argument('name', nargs='?')
+  args = parser.parse_args()
+  if not (args.port or args.exec): parser.error('Give --port or --exec')
+  upload(args)
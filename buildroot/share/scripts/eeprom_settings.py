@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+#
+# eeprom_settings.py
+#
+# Read and write the tagged settings in an eeprom.dat image, as saved
+# by the LINUX HAL with EEPROM_TAGGED_SETTINGS.
+#
+# Usage: eeprom_settings.py dump <eeprom.dat>
+#        eeprom_settings.py export <eeprom.dat> <out.json> [<group>...]
+#        eeprom_settings.py import <in.json> <eeprom.dat>
+#
+# 'export' saves all the groups, or only those named, as JSON. 'import'
+# replaces or adds the groups in the JSON and keeps the rest, so one
+# machine's PID or steps/mm can be copied to others. A missing or erased
+# image is started empty, so the firmware defaults the other groups. An
+# image holding other settings (e.g. saved before EEPROM_TAGGED_SETTINGS)
+# is refused, since those settings would be lost. Load it in the firmware
+# and save it with M500 first, to convert it.
+#
+# The settings are stored at EEPROM_OFFSET as:
+#
+#   "T01" | crc | tag size data | tag size data | ... | 0 0
+#
+# The CRC is CRC-16/XMODEM of everything after it. Each tag is a hash
+# of the SettingsData field that starts the group, so the group names
+# are taken from the EEPROM_RECORD() calls in settings.cpp.
+#
+import binascii, json, os, re, struct, sys
+
+EEPROM_OFFSET = 100     # Must match EEPROM_OFFSET in settings.cpp
+EEPROM_SIZE = 0x1000    # MARLIN_EEPROM_SIZE of the LINUX HAL
+TAGGED_VERSION = b'T01\0'
+
+SETTINGS_CPP = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                            '..', '..', '..', 'Marlin', 'src', 'module', 'settings.cpp')
+
+def record_tag(name):
+    "FNV-1a of the field name folded to 16 bits, as in settings.cpp"
+    h = 2166136261
+    for c in name.encode():
+        h = ((h ^ c) * 16777619) & 0xFFFFFFFF
+    return ((h ^ (h >> 16)) & 0xFFFF) or 1
+
+def group_names():
+    "Map tags to the group names in settings.cpp"
+    try:
+        with open(SETTINGS_CPP) as f: src = f.read()
+    except IOError:
+        return {}
+    return { record_tag(n): n for n in re.findall(r'EEPROM_RECORD\(([\w.]+)\)', src) }
+
+def tag_of(key, names):
+    "A group is given by name or as a hex tag"
+    if re.match(r'0x[0-9A-Fa-f]+$', key): return int(key, 16)
+    return record_tag(key)
+
+def read_records(image):
+    "Return the list of (tag, data) in an image, or exit if it isn't valid"
+    ver = image[EEPROM_OFFSET:EEPROM_OFFSET + 4]
+    if ver != TAGGED_VERSION:
+        sys.exit('Not tagged settings (version %r). Load and M500 them in an EEPROM_TAGGED_SETTINGS build to convert.'
+                 % bytes(ver).split(b'\0')[0].decode('latin-1'))
+    stored_crc, = struct.unpack_from('<H', image, EEPROM_OFFSET + 4)
+    pos = start = EEPROM_OFFSET + 6
+    records = []
+    while True:
+        if pos + 4 > len(image): sys.exit('Records run past the end of the image')
+        tag, size = struct.unpack_from('<HH', image, pos)
+        pos += 4
+        if not tag: break
+        records.append((tag, bytes(image[pos:pos + size])))
+        pos += size
+    crc = binascii.crc_hqx(bytes(image[start:pos]), 0)
+    if crc != stored_crc: sys.exit('CRC mismatch (stored %d, calculated %d)' % (stored_crc, crc))
+    return records
+
+def write_records(image, records):
+    body = b''.join(struct.pack('<HH', tag, len(data)) + data for tag, data in records) + struct.pack('<HH', 0, 0)
+    if EEPROM_OFFSET + 6 + len(body) > len(image): sys.exit('Settings too large for the image')
+    image[EEPROM_OFFSET:EEPROM_OFFSET + 6 + len(body)] = TAGGED_VERSION + struct.pack('<H', binascii.crc_hqx(body, 0)) + body
+
+def load_image(path, create=False):
+    if create and not os.path.exists(path): return bytearray(b'\xFF' * EEPROM_SIZE)
+    with open(path, 'rb') as f: image = bytearray(f.read())
+    return image + bytearray(b'\xFF' * (EEPROM_SIZE - len(image)))
+
+def dump(path):
+    names = group_names()
+    records = read_records(load_image(path))
+    total = 0
+    for tag, data in records:
+        print('%04X %-28s %5d  %s' % (tag, names.get(tag, '?'), len(data), binascii.hexlify(data[:16]).decode() + ('...' if len(data) > 16 else '')))
+        total += len(data)
+    print('%d groups, %d bytes' % (len(records), total))
+
+def export(path, out, keys):
+    names = group_names()
+    records = read_records(load_image(path))
+    if keys:
+        wanted = { tag_of(k, names) for k in keys }
+        missing = wanted - { tag for tag, _ in records }
+        if missing: sys.exit('Not in the image: ' + ', '.join(names.get(t, '%04X' % t) for t in missing))
+        records = [ r for r in records if r[0] in wanted ]
+    groups = [ { 'name': names.get(tag, ''), 'tag': '0x%04X' % tag, 'data': binascii.hexlify(data).decode() } for tag, data in records ]
+    with open(out, 'w') as f: json.dump({ 'version': TAGGED_VERSION[:3].decode(), 'groups': groups }, f, indent=2)
+
+def import_(src, path):
+    names = group_names()
+    with open(src) as f: groups = json.load(f)['groups']
+    image = load_image(path, create=True)
+    if image[EEPROM_OFFSET:EEPROM_OFFSET + 4] == b'\xFF' * 4:
+        records = []                    # Erased, so there are no settings to keep
+    else:
+        records = read_records(image)   # Exits if the image holds other settings
+    for g in groups:
+        tag, data = tag_of(g['tag'] or g['name'], names), binascii.unhexlify(g['data'])
+        for i, (t, _) in enumerate(records):
+            if t == tag:
+                records[i] = (tag, data)
+                break
+        else:
+            records.append((tag, data))
+    write_records(image, records)
+    with open(path, 'wb') as f: f.write(image)
+    print('%d groups written to %s' % (len(groups), path))
+
+if __name__ == '__main__':
+    args = sys.argv[1:]
+    if len(args) == 2 and args[0] == 'dump': dump(args[1])
+    elif len(args) >= 3 and args[0] == 'export': export(args[1], args[2], args[3:])
+    elif len(args) == 3 and args[0] == 'import': import_(args[1], args[2])
+    else: sys.exit('Usage: eeprom_settings.py dump <eeprom.dat>\n'
+                   '       eeprom_settings.py export <eeprom.dat> <out.json> [<group>...]\n'
+                   '       eeprom_settings.py import <in.json> <eeprom.dat>')
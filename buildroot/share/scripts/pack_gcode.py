@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+#
+# pack_gcode.py
+#
+# Convert a G-code file to the pre-parsed binary form accepted
+# by firmware built with PACKED_GCODE, or back to plain text.
+#
+# Usage: pack_gcode.py [--unpack] <infile> <outfile>
+#
+# Each packed command is laid out as:
+#
+#   0xFE | size | letter | code (2) | subcode | params... | checksum
+#
+# 'size' counts the bytes from 'letter' up to the checksum, which is the
+# XOR of those same bytes. Each parameter is a letter index (0-25) with
+# bit 7 set if a little-endian float value follows. Packed commands are
+# not followed by a newline.
+#
+# Packed commands carry no line number or '*' checksum. Sent over serial,
+# each one counts as the next line number, so a host using line numbers
+# must number it like a text line. A bad packed command gets 'Resend:'
+# and 'ok', as for a checksum error.
+#
+# Commands that take a string argument, that chain other commands, or
+# that have any parameter without a value are kept as plain text lines,
+# so both forms can be mixed freely in one file.
+#
+import re, struct, sys
+
+MARKER = 0xFE
+MAX_CMD_SIZE = 96       # Must not exceed MAX_CMD_SIZE in Configuration_adv.h
+MAX_EXACT_INT = 1 << 24 # Larger integers can't be stored exactly in a float
+
+# Commands that must stay as text. Keep in step with GCodeParser::packed_valid()
+# in Marlin/src/gcode/parser.cpp, which refuses the same commands packed.
+KEEP_TEXT = { 'G53', 'M0', 'M1', 'M16', 'M23', 'M28', 'M29', 'M30', 'M32', 'M33',
+              'M108', 'M110', 'M112', 'M117', 'M118', 'M410', 'M928' } \
+          | { 'M%d' % n for n in range(810, 820) }
+
+command_re = re.compile(r'([GMT])(\d+)(?:\.(\d+))?$')
+param_re = re.compile(r' *([A-Z]) *([-+]?(?:\d+\.?\d*|\.\d+))')
+
+def strip_line(line):
+    "Remove the comment, line number, and checksum from a line"
+    line = line.split(';', 1)[0]
+    line = re.sub(r'\*\d*\s*$', '', line).strip()
+    return re.sub(r'^N-?\d+ *', '', line)
+
+def pack_line(line):
+    "Return the packed form of a line, or None to keep it as text"
+    line = strip_line(line)
+    cmd = line.split(' ', 1)[0]
+    m = command_re.match(cmd)
+    if not m or cmd.split('.')[0] in KEEP_TEXT: return None
+    letter, code, sub = m.group(1), int(m.group(2)), int(m.group(3) or 0)
+    if code > 0xFFFF or sub > 0xFF: return None
+
+    payload = bytearray([ord(letter), code & 0xFF, code >> 8, sub])
+    rest, pos = line[len(cmd):], 0
+    while pos < len(rest):
+        p = param_re.match(rest, pos)
+        if not p: return None
+        value = float(p.group(2))
+        if value == int(value) and abs(value) > MAX_EXACT_INT: return None
+        payload.append((ord(p.group(1)) - ord('A')) | 0x80)
+        payload += struct.pack('<f', value)
+        pos = p.end()
+        while pos < len(rest) and rest[pos] == ' ': pos += 1
+
+    if len(payload) + 3 > MAX_CMD_SIZE: return None
+    checksum = 0
+    for b in payload: checksum ^= b
+    return bytes(bytearray([MARKER, len(payload)]) + payload + bytearray([checksum]))
+
+def format_float(f):
+    "Shortest decimal that reads back as the same float"
+    for digits in range(10):
+        s = '%.*f' % (digits, f)
+        if struct.pack('<f', float(s)) == struct.pack('<f', f): break
+    return s.rstrip('0').rstrip('.') if '.' in s else s
+
+def unpack_record(rec):
+    "Return the text form of one packed command"
+    letter, code, sub = chr(rec[2]), rec[3] | (rec[4] << 8), rec[5]
+    out = letter + str(code) + ('.%d' % sub if sub else '')
+    i = 6
+    while i < len(rec) - 1:
+        pb = rec[i]; i += 1
+        out += ' ' + chr(ord('A') + (pb & 0x7F))
+        if pb & 0x80:
+            out += format_float(struct.unpack('<f', bytes(rec[i:i+4]))[0])
+            i += 4
+    return out
+
+def pack(data):
+    out = bytearray()
+    packed = total = 0
+    for line in data.decode('latin-1').splitlines():
+        rec = pack_line(line)
+        if rec:
+            out += rec
+            packed += 1
+        elif strip_line(line):
+            out += (line.rstrip() + '\n').encode('latin-1')
+        else:
+            continue
+        total += 1
+    print('%d of %d commands packed, %d -> %d bytes' % (packed, total, len(data), len(out)))
+    return out
+
+def unpack(data):
+    out, i = [], 0
+    while i < len(data):
+        if data[i] == MARKER:              # Only found at the start of a line
+            size = data[i + 1] + 3
+            rec = bytearray(data[i:i + size])
+            checksum = 0
+            for b in rec[2:-1]: checksum ^= b
+            if checksum != rec[-1]: sys.exit('Bad checksum at offset %d' % i)
+            out.append(unpack_record(rec) + '\n')
+            i += size
+            continue
+        end = data.find(b'\n', i)
+        end = len(data) if end < 0 else end + 1
+        out.append(data[i:end].decode('latin-1'))
+        i = end
+    return ''.join(out).encode('latin-1')
+
+if __name__ == '__main__':
+    args = sys.argv[1:]
+    do_unpack = '--unpack' in args
+    if do_unpack: args.remove('--unpack')
+    if len(args) != 2: sys.exit('Usage: pack_gcode.py [--unpack] <infile> <outfile>')
+    with open(args[0], 'rb') as f: data = f.read()
+    with open(args[1], 'wb') as f: f.write(unpack(data) if do_unpack else pack(data))